@@ -0,0 +1,101 @@
+#pragma once
+#include <bits/stdc++.h>
+#include "../utils/ThreadPool.h"
+using namespace std;
+
+// Block Sparse Table supporting range queries on a static array, where the
+//   array is split into blocks of size 2^LGB, a sparse table is built over
+//   the block summaries, and the partial blocks at the ends of a query are
+//   scanned directly
+// Scans use W independent accumulators over chunks of W elements, with the
+//   last chunk overlapping the previous one, which is only valid since op is
+//   idempotent, and allows the compiler to vectorize the scan
+// Indices are 0-indexed and ranges are inclusive with the exception of
+//   functions that accept two iterators as a parameter, such as
+//   the constructor, which are exclusive
+// Template Arguments:
+//   T: the type of each element
+//   Op: a struct with the operation (can also be of type
+//       std::function<T(T, T)>); in practice, custom struct is faster
+//       than std::function
+//     Required Functions:
+//       operator (l, r): combines the values l and r, must be associative
+//         and idempotent
+//   LGB: the log base 2 of the block size
+// Constructor Arguments:
+//   N: the size of the array
+//   f: a generator function that returns the ith element on the ith call
+//   st: an iterator pointing to the first element in the array
+//   en: an iterator pointing to after the last element in the array
+//   pool: a ThreadPool used to compute the block summaries and each level
+//     of the sparse table in parallel
+//   op: an instance of the Op struct
+// Functions:
+//   query(l, r): returns the aggregate value of the elements in
+//     the range [l, r]
+// In practice, the constructor has a very small constant and is much faster
+//   than sparse table's constructor, and query has a moderate constant and
+//   is slightly slower than sparse table's query for small arrays, but uses
+//   a fraction of the memory, which allows it to be used on arrays where a
+//   sparse table does not fit in memory
+// Time Complexity:
+//   constructor: O(N + N / 2^LGB log (N / 2^LGB))
+//   query: O(2^LGB / W) assuming the scans are vectorized
+// Memory Complexity: O(N + N / 2^LGB log (N / 2^LGB))
+// Tested:
+//   Fuzz and Stress Tested
+template <class T, class Op, const int LGB = 6> struct BlockSparseTable {
+  static constexpr int B = 1 << LGB, W = 8;
+  int N, M, K; vector<T> A, ST; Op op;
+  T scan(int l, int r) {
+    const T *a = A.data(); if (r - l + 1 < W) {
+      T ret = a[l]; for (int i = l + 1; i <= r; i++) ret = op(ret, a[i]);
+      return ret;
+    }
+    T acc[W]; for (int j = 0; j < W; j++) acc[j] = a[l + j];
+    for (l += W; l + W - 1 <= r; l += W)
+      for (int j = 0; j < W; j++) acc[j] = op(acc[j], a[l + j]);
+    for (int j = 0; j < W; j++) acc[j] = op(acc[j], a[r - W + 1 + j]);
+    for (int w = W / 2; w > 0; w /= 2)
+      for (int j = 0; j < w; j++) acc[j] = op(acc[j], acc[j + w]);
+    return acc[0];
+  }
+  template <class F> void build(F f, ThreadPool *pool) {
+    A.reserve(N); for (int i = 0; i < N; i++) A.push_back(f());
+    ST.resize(size_t(K) * M);
+    parallelFor(pool, M, [&] (int, long long lo, long long hi) {
+      for (int j = lo; j < hi; j++)
+        ST[j] = scan(j << LGB, min(N, (j + 1) << LGB) - 1);
+    }, 1 << 12);
+    for (int i = 0; i < K - 1; i++) {
+      T *cur = ST.data() + size_t(i) * M, *nxt = cur + M;
+      parallelFor(pool, M, [&] (int, long long lo, long long hi) {
+        for (int j = lo; j < hi; j++)
+          nxt[j] = op(cur[j], cur[min(j + (1 << i), M - 1)]);
+      }, 1 << 12);
+    }
+  }
+  template <class F> BlockSparseTable(int N, F f, Op op = Op())
+      : N(N), M((N + B - 1) >> LGB), K(M == 0 ? 0 : __lg(M) + 1), op(op) {
+    build(f, nullptr);
+  }
+  template <class F>
+  BlockSparseTable(int N, F f, ThreadPool &pool, Op op = Op())
+      : N(N), M((N + B - 1) >> LGB), K(M == 0 ? 0 : __lg(M) + 1), op(op) {
+    build(f, &pool);
+  }
+  template <class It> BlockSparseTable(It st, It en, Op op = Op())
+      : BlockSparseTable(en - st, [&] { return *st++; }, op) {}
+  template <class It>
+  BlockSparseTable(It st, It en, ThreadPool &pool, Op op = Op())
+      : BlockSparseTable(en - st, [&] { return *st++; }, pool, op) {}
+  T query(int l, int r) {
+    int bl = l >> LGB, br = r >> LGB; if (bl == br) return scan(l, r);
+    T ret = op(scan(l, ((bl + 1) << LGB) - 1), scan(br << LGB, r));
+    if (++bl < br--) {
+      int i = __lg(br - bl + 1); const T *s = ST.data() + size_t(i) * M;
+      ret = op(ret, op(s[bl], s[br - (1 << i) + 1]));
+    }
+    return ret;
+  }
+};
@@ -1,5 +1,6 @@
 #pragma once
 #include <bits/stdc++.h>
+#include "../utils/ThreadPool.h"
 using namespace std;
 
 // Fischer Heun Structure supporting range maximum queries on a static array
@@ -10,12 +11,20 @@ using namespace std;
 // queryInd: returns the index of the maximum element in the subarray [l, r],
 //   breaking ties by selecting the first such index
 // query: returns the maximum element in the subarray [l, r]
+// queryInd(queries), query(queries): returns the result of queryInd or
+//   query for each pair (l, r) in queries, where the queries are answered
+//   in groups of G, and the memory for each group is prefetched before any
+//   query in the group is answered, so the cache misses of different
+//   queries overlap
+// queryInd(queries, pool), query(queries, pool): same as above, with the
+//   groups split between the threads of pool
 // In practice, the constructor has a moderate constant and is significantly
 //   faster than sparse table's constructor, query has a moderate constant and
 //   is slightly slower than sparse table's query
 // Time Complexity:
 //   constructor: O(N / B log (N / B)), where B is the number of bits in mask_t
 //   query: O(1) assuming bitshift for mask_t is O(1)
+//   batched queryInd, query: O(Q) for Q queries
 // Memory Complexity: O(N + N / B log (N / B)) assuming mask_t is O(1) memory
 // Tested:
 //   Fuzz and Stress Tested
@@ -55,4 +64,40 @@ struct FischerHeunStructure {
     return cmpInd(ql, qr);
   }
   T query(int l, int r) { return A[queryInd(l, r)]; }
+  static constexpr int G = 16;
+  void prefetch(int l, int r) {
+    __builtin_prefetch(&mask[r]); __builtin_prefetch(&mask[min(r, l + B - 1)]);
+    l = l / B + 1; r = r / B - 1; if (l <= r) {
+      int i = __lg(r - l + 1); __builtin_prefetch(&ST[i][l]);
+      __builtin_prefetch(&ST[i][r - (1 << i) + 1]);
+    }
+  }
+  template <class R, class F> vector<R> batch(
+      const vector<pair<int, int>> &queries, F f, ThreadPool *pool) {
+    vector<R> ret(queries.size());
+    auto g = [&] (int, long long lo, long long hi) {
+      for (long long s = lo; s < hi; s += G) {
+        long long e = min(hi, s + G);
+        for (long long i = s; i < e; i++)
+          prefetch(queries[i].first, queries[i].second);
+        for (long long i = s; i < e; i++)
+          ret[i] = f(queryInd(queries[i].first, queries[i].second));
+      }
+    };
+    parallelFor(pool, queries.size(), g, 1 << 14);
+    return ret;
+  }
+  vector<int> queryInd(const vector<pair<int, int>> &queries) {
+    return batch<int>(queries, [&] (int i) { return i; }, nullptr);
+  }
+  vector<int> queryInd(const vector<pair<int, int>> &queries,
+                       ThreadPool &pool) {
+    return batch<int>(queries, [&] (int i) { return i; }, &pool);
+  }
+  vector<T> query(const vector<pair<int, int>> &queries) {
+    return batch<T>(queries, [&] (int i) { return A[i]; }, nullptr);
+  }
+  vector<T> query(const vector<pair<int, int>> &queries, ThreadPool &pool) {
+    return batch<T>(queries, [&] (int i) { return A[i]; }, &pool);
+  }
 };
@@ -1,44 +1,98 @@
 #pragma once
 #include <bits/stdc++.h>
+#include "../utils/ParallelScan.h"
+#include "../utils/ThreadPool.h"
 using namespace std;
 
 // A collections of functions for 2d prefix sum and difference arrays
 
 // Creates a prefix sum array pre from the 2d array A of size N x M
 // pre[i][j] is the sum of all elements in the subarray A[0..i][0..j]
+// Each row is scanned and the previous row is added to it while it is still
+//   in cache; if a ThreadPool is given, the rows are split into one strip
+//   per thread, each strip is computed independently, the last rows of the
+//   strips are combined, and then the last row of the previous strip is
+//   added to the other rows of each strip
+// Each row must be stored contiguously, and A and pre can be the same array
 // Indices are 0-indexed
 // In practice, has a small constant
-// Time Complexity: O(NM)
+// Time Complexity: O(NM), O(NM / P + PM) with P threads
 // Memory Complexity: O(1) additional memory
 // Tested:
 //   Fuzz and Stress Tested
 //   https://codeforces.com/contest/635/problem/A
 //   https://dmoj.ca/problem/dmpg15s5
+template <class C>
+void partial_sum_2d_strip(const C &A, int lo, int hi, int M, C &pre) {
+  using T = typename decay<decltype(pre[0][0])>::type;
+  if (M > 0) for (int i = lo; i < hi; i++) {
+    inclusiveScan(&A[i][0], &A[i][0] + M, &pre[i][0], T());
+    if (i > lo) for (int j = 0; j < M; j++) pre[i][j] += pre[i - 1][j];
+  }
+}
 template <class C> void partial_sum_2d(const C &A, int N, int M, C &pre) {
-  for (int i = 0; i < N; i++) for (int j = 0; j < M; j++) {
-    pre[i][j] = A[i][j];
-    if (i > 0) pre[i][j] += pre[i - 1][j];
-    if (j > 0) pre[i][j] += pre[i][j - 1];
-    if (i > 0 && j > 0) pre[i][j] -= pre[i - 1][j - 1];
+  partial_sum_2d_strip(A, 0, N, M, pre);
+}
+template <class C>
+void partial_sum_2d(const C &A, int N, int M, C &pre, ThreadPool &pool) {
+  int P = pool.size(); pool.run([&] (int t) {
+    partial_sum_2d_strip(A, 1LL * N * t / P, 1LL * N * (t + 1) / P, M, pre);
+  });
+  for (int t = 1; t < P; t++) {
+    int lo = 1LL * N * t / P, hi = 1LL * N * (t + 1) / P;
+    if (lo > 0 && lo < hi)
+      for (int j = 0; j < M; j++) pre[hi - 1][j] += pre[lo - 1][j];
   }
+  pool.run([&] (int t) {
+    int lo = 1LL * N * t / P, hi = 1LL * N * (t + 1) / P;
+    if (lo > 0) for (int i = lo; i < hi - 1; i++)
+      for (int j = 0; j < M; j++) pre[i][j] += pre[lo - 1][j];
+  });
 }
 
 // Creates a difference array diff from the 2d array A of size N x M
 // A[i][j] is the sum of all elements in the subarray diff[0..i][0..j]
+// If a ThreadPool is given, the rows are split into one strip per thread,
+//   and the row before each strip is copied before the strips are computed
+//   independently
+// Each row must be stored contiguously, and diff and A can be the same array
 // Indices are 0-indexed
 // In practice, has a small constant
-// Time Complexity: O(NM)
-// Memory Complexity: O(1) additional memory
+// Time Complexity: O(NM), O(NM / P + PM) with P threads
+// Memory Complexity: O(1) additional memory, O(PM) with P threads
 // Tested:
 //   Fuzz and Stress Tested
+template <class C, class T>
+void adjacent_difference_2d_strip(const C &diff, int lo, int hi, int M, C &A,
+                                  const T *up) {
+  for (int i = hi - 1; i >= lo; i--) {
+    const T *u = i > lo ? &diff[i - 1][0] : up;
+    for (int j = M - 1; j >= 0; j--) {
+      T v = diff[i][j]; if (j > 0) v -= diff[i][j - 1];
+      if (u) { v -= u[j]; if (j > 0) v += u[j - 1]; }
+      A[i][j] = v;
+    }
+  }
+}
 template <class C>
 void adjacent_difference_2d(const C &diff, int N, int M, C &A) {
-  for (int i = N - 1; i >= 0; i--) for (int j = M - 1; j >= 0; j--) {
-    A[i][j] = diff[i][j];
-    if (i > 0) A[i][j] -= diff[i - 1][j];
-    if (j > 0) A[i][j] -= diff[i][j - 1];
-    if (i > 0 && j > 0) A[i][j] += diff[i - 1][j - 1];
-  }
+  using T = typename decay<decltype(A[0][0])>::type;
+  if (M > 0) adjacent_difference_2d_strip(diff, 0, N, M, A, (const T *)0);
+}
+template <class C> void adjacent_difference_2d(const C &diff, int N, int M,
+                                               C &A, ThreadPool &pool) {
+  using T = typename decay<decltype(A[0][0])>::type;
+  if (M == 0) return;
+  int P = pool.size(); vector<vector<T>> up(P); pool.run([&] (int t) {
+    int lo = 1LL * N * t / P, hi = 1LL * N * (t + 1) / P;
+    if (lo > 0 && lo < hi)
+      up[t].assign(&diff[lo - 1][0], &diff[lo - 1][0] + M);
+  });
+  pool.run([&] (int t) {
+    adjacent_difference_2d_strip(diff, 1LL * N * t / P,
+                                 1LL * N * (t + 1) / P, M, A,
+                                 up[t].empty() ? (const T *)0 : up[t].data());
+  });
 }
 
 // Computes the sum of a subarray A[u..d][l..r] with prefix sum array pre
@@ -9,7 +9,8 @@ using namespace std;
 // In practice, the constructor has a small constant,
 //   query has a moderate constant, but still faster than segment trees,
 //   slightly faster than Fischer Heun Structure, and performs similarly to
-//   disjoint sparse tables
+//   disjoint sparse tables, but uses much more memory than the block sparse
+//   table in BlockSparseTable.h
 // op must be an associative and idempotent operation
 // op must also be passed in the constructor with its type specified
 //   as a template parameter, and must be constructable; thus, it cannot be
@@ -27,11 +28,11 @@ using namespace std;
 template <class T, class Op> struct SparseTable {
   int N; vector<vector<T>> ST; Op op;
   template <class F> SparseTable(int N, F f, Op op = Op())
-      : N(N), ST(N == 0 ? 0 : __lg(N) + 1), op(op) {
+      : N(N), ST(N == 0 ? 1 : __lg(N) + 1), op(op) {
     ST[0].reserve(N); for (int i = 0; i < N; i++) ST[0].push_back(f());
     for (int i = 0; i < int(ST.size()) - 1; i++) {
-      ST[i + 1] = ST[0]; for (int j = 0; j < N; j++)
-        ST[i + 1][j] = op(ST[i][j], ST[i][min(j + (1 << i), N - 1)]);
+      ST[i + 1].reserve(N); for (int j = 0; j < N; j++)
+        ST[i + 1].push_back(op(ST[i][j], ST[i][min(j + (1 << i), N - 1)]));
     }
   }
   template <class It> SparseTable(It st, It en, Op op = Op())
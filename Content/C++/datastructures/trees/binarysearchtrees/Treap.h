@@ -1,10 +1,14 @@
 #pragma once
 #include <bits/stdc++.h>
 #include "../../../utils/Random.h"
+#include "../../../utils/ThreadPool.h"
 using namespace std;
 
 // Generic Treap node operations supporting a generic node class (such
 //   as the structs in BSTNode.h)
+// Nodes are stored in a pool of contiguous blocks allocated with the
+//   allocator Alloc (rebound to the internal node type), which can be an
+//   ArenaAllocator, and cleared nodes are reused before allocating new ones
 // Indices are 0-indexed and ranges are inclusive
 // makeNode creates a new node passing v to the node constructor
 // applyToRange applies the function f to a node x where x is the disconnected
@@ -15,8 +19,21 @@ using namespace std;
 // getFirst returns the first node y (and its index) in the subtree of x
 //   where cmp(y->val, v) returns false
 // build builds a treap with N nodes using a generating function f
-//   that passes a single argument to the node constructor
+//   that passes a single argument to the node constructor, by inserting
+//   each node into the right spine of a Cartesian tree with a stack
 // clear adds all nodes in the subtree of x to the deleted buffer
+// reserve allocates a single contiguous block for n more nodes
+// setUnion, setIntersection, and setDifference each take two treaps a and b
+//   with strictly increasing values under cmp, and return a treap of the
+//   values in a or b, in a and b, and in a but not b respectively, by
+//   splitting the treap with the lower priority root around the other root
+//   and recursing on both halves; nodes that are not part of the result are
+//   added to the deleted buffer, and both a and b are consumed
+// If a ThreadPool with T threads is passed to a set operation, the top
+//   lg T + 4 levels of the recursion are expanded sequentially, and the
+//   up to 16T independent subproblems below them are each solved
+//   sequentially by one of the threads, as calls to the ThreadPool cannot
+//   be nested
 // Node must have the following:
 //   constructor: takes a single argument with the information for the node
 //   HAS_PAR: const static bool indicating whether this node has
@@ -29,17 +46,24 @@ using namespace std;
 //   propagate: void() that pushes information lazily to the children
 //   If HAS_PAR is true, then it should also contain the following:
 //     p: pointer of the same node type to the parent
-//   If getFirst is called, then the following is also required:
+//   If getFirst or a set operation is called, then the following is also
+//       required:
 //     val: any type representing the value of the node
 // Can be used in conjunction with DynamicRangeOperations to support
 //   range operations using treap node operations
 // In practice, has a moderate constant, not as fast as segment trees
-//   and slightly slower than Splay
+//   and slightly slower than Splay, while build and the set operations are
+//   several times faster than inserting elements one by one
 // Time Complexity:
-//   build: O(N) expected
-//   clear: O(N)
-//   makeNode: O(1)
+//   build, clear, reserve: O(N)
+//   makeNode: O(1) amortized
 //   merge, split, applyToRange, index, select, getFirst: O(log N) expected
+//   setUnion, setIntersection, setDifference: O(M log (N / M + 1)) expected
+//     for treaps of sizes M <= N
+//   parallel setUnion, setIntersection, setDifference: the same total work,
+//     with O(T log N) expected sequential work for the expansion, followed
+//     by the subproblems, where the time is bounded by the largest
+//     subproblem, which is O(M log (N / M + 1)) in the worst case
 // Memory Complexity: O(N)
 // Tested:
 //   https://dmoj.ca/problem/ds4 (applyToRange, select, getFirst)
@@ -48,17 +72,44 @@ using namespace std;
 //   https://dmoj.ca/problem/dmpg17g2 (applyToRange)
 //   https://dmoj.ca/problem/acc1p1 (applyToRange)
 //   https://dmoj.ca/problem/noi05p2 (applyToRange)
-template <class _Node> struct Treap {
+//   Fuzz and Stress Tested (build, set operations)
+template <class _Node, class Alloc = allocator<_Node>> struct Treap {
   using Node = _Node;
   struct TreapNode : public Node {
     long long pri;
     template <class T> TreapNode(const T &v)
         : Node(v), pri(uniform_int_distribution<long long>()(rng64)) {}
   };
-  deque<TreapNode> TR; deque<Node*> deleted;
+  using NodeAlloc =
+      typename allocator_traits<Alloc>::template rebind_alloc<TreapNode>;
+  struct Block { TreapNode *p; int used, cap; };
+  enum SetOp { UNION, INTERSECTION, DIFFERENCE };
+  struct Frame { Node *p, *eq, *a[2], *b[2]; bool fromA; int ch[2]; };
+  NodeAlloc alloc; vector<Block> blocks; long long total;
+  vector<Node*> deleted;
+  Treap(const Alloc &alloc = Alloc()) : alloc(alloc), total(0) {}
+  Treap(const Treap &) = delete;
+  Treap &operator = (const Treap &) = delete;
+  ~Treap() {
+    for (auto &&b : blocks) {
+      for (int i = 0; i < b.used; i++) b.p[i].~TreapNode();
+      alloc.deallocate(b.p, b.cap);
+    }
+  }
+  void reserve(int n) {
+    if (n <= 0) return;
+    if (blocks.empty() || blocks.back().cap - blocks.back().used < n) {
+      blocks.push_back(Block{alloc.allocate(n), 0, n}); total += n;
+    }
+  }
   template <class T> Node *makeNode(const T &v) {
-    if (deleted.empty()) { TR.emplace_back(v); return &TR.back(); }
-    Node *x = deleted.back(); deleted.pop_back(); *x = TreapNode(v); return x;
+    if (!deleted.empty()) {
+      Node *x = deleted.back(); deleted.pop_back();
+      *static_cast<TreapNode*>(x) = TreapNode(v); return x;
+    }
+    if (blocks.empty() || blocks.back().used == blocks.back().cap)
+      reserve(int(max(total, 1LL << 10)));
+    Block &b = blocks.back(); return new (b.p + b.used++) TreapNode(v);
   }
   long long pri(Node *x) { return static_cast<TreapNode*>(x)->pri; }
   void merge(Node *&x, Node *l, Node *r) {
@@ -113,16 +164,117 @@ template <class _Node> struct Treap {
     }
     return ret;
   }
-  template <class F> Node *buildRec(int l, int r, F &f) {
-    if (l > r) return nullptr;
-    if (l == r) return makeNode(f());
-    int m = l + (r - l) / 2; Node *ret;
-    Node *left = buildRec(l, m, f), *right = buildRec(m + 1, r, f);
-    merge(ret, left, right); return ret;
+  template <class F> Node *build(int N, F f) {
+    reserve(N - int(min(deleted.size(), size_t(N)))); vector<Node *> stk;
+    for (int i = 0; i < N; i++) {
+      Node *x = makeNode(f()), *last = nullptr;
+      while (!stk.empty() && pri(stk.back()) < pri(x)) {
+        last = stk.back(); stk.pop_back(); last->update();
+      }
+      x->l = last; setP(last, x);
+      if (!stk.empty()) { stk.back()->r = x; setP(x, stk.back()); }
+      stk.push_back(x);
+    }
+    for (int i = int(stk.size()) - 1; i >= 0; i--) stk[i]->update();
+    return stk.empty() ? nullptr : stk[0];
   }
-  template <class F> Node *build(int N, F f) { return buildRec(0, N - 1, f); }
-  void clear(Node *x) {
+  void clear(Node *x, vector<Node*> &del) {
     if (!x) return;
-    clear(x->l); deleted.push_back(x); clear(x->r);
+    clear(x->l, del); del.push_back(x); clear(x->r, del);
+  }
+  void clear(Node *x) { clear(x, deleted); }
+  template <class T, class Comp>
+  void splitVal(Node *x, Node *&l, Node *&r, const T &v, Comp &cmp, bool le) {
+    if (!x) { l = r = nullptr; return; }
+    x->propagate(); setP(x, nullptr);
+    if (le ? !cmp(v, x->val) : cmp(x->val, v)) {
+      splitVal(x->r, x->r, r, v, cmp, le); l = x; setP(x->r, x);
+    } else { splitVal(x->l, l, x->l, v, cmp, le); r = x; setP(x->l, x); }
+    x->update();
+  }
+  bool setOpBase(SetOp op, Node *a, Node *b, Node *&res, vector<Node*> &del) {
+    if (a && b) return false;
+    if (op == UNION) res = a ? a : b;
+    else if (op == INTERSECTION) {
+      clear(a, del); clear(b, del); res = nullptr;
+    }
+    else { clear(b, del); res = a; }
+    return true;
+  }
+  template <class Comp> Frame setOpSplit(Node *a, Node *b, Comp &cmp) {
+    Frame f; f.fromA = pri(a) >= pri(b); f.p = f.fromA ? a : b;
+    Node *o = f.fromA ? b : a, *ol, *orr; f.p->propagate(); setP(f.p, nullptr);
+    splitVal(o, ol, orr, f.p->val, cmp, false);
+    splitVal(orr, f.eq, orr, f.p->val, cmp, true);
+    f.a[0] = f.fromA ? f.p->l : ol; f.b[0] = f.fromA ? ol : f.p->l;
+    f.a[1] = f.fromA ? f.p->r : orr; f.b[1] = f.fromA ? orr : f.p->r;
+    setP(f.p->l, nullptr); setP(f.p->r, nullptr); return f;
+  }
+  Node *setOpJoin(SetOp op, Frame &f, Node *l, Node *r, vector<Node*> &del) {
+    if (f.eq) del.push_back(f.eq);
+    if (op == UNION || (op == INTERSECTION && f.eq)
+        || (op == DIFFERENCE && f.fromA && !f.eq)) {
+      f.p->l = l; f.p->r = r; setP(l, f.p); setP(r, f.p); f.p->update();
+      return f.p;
+    }
+    del.push_back(f.p); Node *x; merge(x, l, r); return x;
+  }
+  template <class Comp>
+  Node *setOp(SetOp op, Node *a, Node *b, Comp &cmp, vector<Node*> &del) {
+    Node *res; if (setOpBase(op, a, b, res, del)) return res;
+    Frame f = setOpSplit(a, b, cmp);
+    Node *l = setOp(op, f.a[0], f.b[0], cmp, del);
+    Node *r = setOp(op, f.a[1], f.b[1], cmp, del);
+    return setOpJoin(op, f, l, r, del);
+  }
+  template <class Comp>
+  Node *setOp(SetOp op, Node *a, Node *b, Comp &cmp, ThreadPool &pool) {
+    vector<Frame> F; vector<array<Node *, 3>> leaves;
+    function<int(Node *, Node *, int)> expand = [&] (Node *a, Node *b,
+                                                     int d) {
+      if (d == 0 || !a || !b) {
+        leaves.push_back(array<Node *, 3>{{a, b, nullptr}});
+        return ~int(leaves.size() - 1);
+      }
+      int id = F.size(); F.push_back(setOpSplit(a, b, cmp));
+      for (int i = 0; i < 2; i++) {
+        int c = expand(F[id].a[i], F[id].b[i], d - 1); F[id].ch[i] = c;
+      }
+      return id;
+    };
+    int root = expand(a, b, __lg(pool.size()) + 4);
+    vector<vector<Node*>> del(pool.size());
+    pool.parallelFor(leaves.size(), [&] (int t, long long lo, long long hi) {
+      for (long long i = lo; i < hi; i++)
+        leaves[i][2] = setOp(op, leaves[i][0], leaves[i][1], cmp, del[t]);
+    }, 1);
+    for (auto &&d : del) deleted.insert(deleted.end(), d.begin(), d.end());
+    function<Node *(int)> collect = [&] (int id) {
+      if (id < 0) return leaves[~id][2];
+      Node *l = collect(F[id].ch[0]), *r = collect(F[id].ch[1]);
+      return setOpJoin(op, F[id], l, r, deleted);
+    };
+    Node *ret = collect(root); setP(ret, nullptr); return ret;
+  }
+  template <class Comp> Node *setUnion(Node *a, Node *b, Comp cmp) {
+    return setOp(UNION, a, b, cmp, deleted);
+  }
+  template <class Comp> Node *setIntersection(Node *a, Node *b, Comp cmp) {
+    return setOp(INTERSECTION, a, b, cmp, deleted);
+  }
+  template <class Comp> Node *setDifference(Node *a, Node *b, Comp cmp) {
+    return setOp(DIFFERENCE, a, b, cmp, deleted);
+  }
+  template <class Comp>
+  Node *setUnion(Node *a, Node *b, Comp cmp, ThreadPool &pool) {
+    return setOp(UNION, a, b, cmp, pool);
+  }
+  template <class Comp>
+  Node *setIntersection(Node *a, Node *b, Comp cmp, ThreadPool &pool) {
+    return setOp(INTERSECTION, a, b, cmp, pool);
+  }
+  template <class Comp>
+  Node *setDifference(Node *a, Node *b, Comp cmp, ThreadPool &pool) {
+    return setOp(DIFFERENCE, a, b, cmp, pool);
   }
 };
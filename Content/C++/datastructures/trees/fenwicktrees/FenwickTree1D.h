@@ -1,5 +1,6 @@
 #pragma once
 #include <bits/stdc++.h>
+#include "../../../utils/ThreadPool.h"
 using namespace std;
 
 // Fenwick Tree or Binary Indexed Tree supporting point updates
@@ -9,11 +10,24 @@ using namespace std;
 //   the constructor, which are exclusive
 // bsearch returns first index where cmp returns false,
 //   or N if no such index exists
+// applyUpdates(st, en) applies a batch of (index, delta) pairs, either one
+//   at a time, or by converting the tree back to an array in place, bucketing
+//   the deltas by index, and rebuilding it in linear time when the batch is
+//   large relative to N
+// queryBatch(st, en, out, pool) writes the prefix sum up to each index in
+//   [st, en) to the corresponding position in out, dividing the queries among
+//   the threads in the pool, and must not run concurrently with any update
 // In practice, this version performs as well as the multidimensional version
 // Small constant, like most fenwick trees, and faster than segment trees
+// Rebuilding is faster than individual updates once the batch has more than
+//   roughly N / 16 updates, while sorting the updates by index first is
+//   slower than either
 // Time Complexity:
 //   constructor, values: O(N)
 //   update, query, bsearch, lower_bound, upper_bound: O(log N)
+//   applyUpdates: O(min(K log N, N + K)) for K updates
+//   queryBatch: O(K log N) work for K queries, divided among the threads in
+//     the pool
 // Memory Complexity: O(N)
 // Tested:
 //   Fuzz and Stress Tested
@@ -51,6 +65,32 @@ template <class T> struct FenwickTree1D {
     }
     return ind;
   }
+  template <class It> void applyUpdates(It st, It en) {
+    long long K = en - st; if (K * 16 >= N) {
+      for (int i = N; i >= 1; i--) {
+        int j = i + (i & -i); if (j <= N) BIT[j] -= BIT[i];
+      }
+      for (It it = st; it != en; it++) BIT[it->first + 1] += it->second;
+      for (int i = 1; i <= N; i++) {
+        int j = i + (i & -i); if (j <= N) BIT[j] += BIT[i];
+      }
+      return;
+    }
+    for (It it = st; it != en; it++) update(it->first, it->second);
+  }
+  void applyUpdates(const vector<pair<int, T>> &updates) {
+    applyUpdates(updates.begin(), updates.end());
+  }
+  template <class It, class Out>
+  void queryBatch(It st, It en, Out out, ThreadPool &pool) {
+    pool.parallelFor(en - st, [&] (int, long long lo, long long hi) {
+      for (long long i = lo; i < hi; i++) out[i] = query(st[i]);
+    }, 1 << 12);
+  }
+  vector<T> queryBatch(const vector<int> &inds, ThreadPool &pool) {
+    vector<T> ret(inds.size());
+    queryBatch(inds.begin(), inds.end(), ret.begin(), pool); return ret;
+  }
   int lower_bound(T v) { return bsearch(v, less<T>()); }
   int upper_bound(T v) { return bsearch(v, less_equal<T>()); }
 };
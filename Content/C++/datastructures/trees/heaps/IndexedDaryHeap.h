@@ -0,0 +1,79 @@
+#pragma once
+#include <bits/stdc++.h>
+using namespace std;
+
+// Indexed D-ary Heap supporting changing the key of an index in the heap
+// Each index in the range [0, N) is in the heap at most once, and the keys
+//   are stored next to the indices in the heap array so comparisons do not
+//   require indirect memory accesses
+// top and pop return the key-index pair with the maximum key
+// Comparator convention is same as priority_queue in STL
+// Indices are 0-indexed
+// Template Arguments:
+//   Key: the type of the keys
+//   D: the number of children of each node, where 4 or 8 usually fills a
+//     cache line with the children of a node
+//   Comparator: the comparator to compare two keys
+//     Required Functions:
+//       operator (a, b): returns true if and only if a compares less than b
+// Constructor Arguments:
+//   N: the number of indices
+// Functions:
+//   empty(): returns whether the heap is empty
+//   size(): returns the number of indices in the heap
+//   contains(i): returns whether index i is in the heap
+//   top(): returns the key-index pair with the maximum key
+//   pop(): removes and returns the key-index pair with the maximum key
+//   push(i, key): inserts index i with the key key if i is not in the heap,
+//     otherwise changes the key of index i to key
+// In practice, has a very small constant, and is faster than a binary heap
+//   when there are more pushes than pops
+// Time Complexity:
+//   constructor: O(N)
+//   empty, size, contains, top: O(1)
+//   pop: O(D log N / log D)
+//   push: O(log N / log D) if the key increases or i is not in the heap,
+//     O(D log N / log D) otherwise
+// Memory Complexity: O(N)
+// Tested:
+//   Stress Tested
+template <class Key, const int D = 4, class Comparator = less<Key>>
+struct IndexedDaryHeap {
+  static_assert(D >= 2, "D must be at least 2");
+  vector<pair<Key, int>> H; vector<int> pos; Comparator cmp;
+  IndexedDaryHeap(int N) : pos(N, -1) {}
+  bool empty() const { return H.empty(); }
+  int size() const { return H.size(); }
+  bool contains(int i) const { return pos[i] != -1; }
+  void place(int j, const pair<Key, int> &p) { pos[(H[j] = p).second] = j; }
+  void up(int j) {
+    pair<Key, int> p = H[j]; for (int k; j > 0; j = k) {
+      if (!cmp(H[k = (j - 1) / D].first, p.first)) break;
+      place(j, H[k]);
+    }
+    place(j, p);
+  }
+  void down(int j) {
+    pair<Key, int> p = H[j]; for (int n = H.size(); ; ) {
+      int c = j * D + 1, en = min(n, c + D); if (c >= n) break;
+      for (int k = c + 1; k < en; k++) if (cmp(H[c].first, H[k].first)) c = k;
+      if (!cmp(p.first, H[c].first)) break;
+      place(j, H[c]); j = c;
+    }
+    place(j, p);
+  }
+  pair<Key, int> top() const { return H[0]; }
+  pair<Key, int> pop() {
+    pair<Key, int> ret = H[0]; pos[ret.second] = -1;
+    if (int(H.size()) > 1) { H[0] = H.back(); H.pop_back(); down(0); }
+    else H.pop_back();
+    return ret;
+  }
+  void push(int i, const Key &key) {
+    if (pos[i] == -1) { pos[i] = H.size(); H.emplace_back(key, i); }
+    else if (cmp(key, H[pos[i]].first)) {
+      H[pos[i]].first = key; down(pos[i]); return;
+    }
+    H[pos[i]].first = key; up(pos[i]);
+  }
+};
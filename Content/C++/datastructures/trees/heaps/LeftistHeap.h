@@ -1,33 +1,38 @@
 #pragma once
 #include <bits/stdc++.h>
-#if __cplusplus < 201402L
-#include "../../../utils/MakeUnique.h"
-#endif
 using namespace std;
 
 // Heap supporting merges
 // comparator convention is same as priority_queue in STL
+// Nodes are allocated with Alloc, which can be an ArenaAllocator
 // Time Complexity:
 //   constructor, empty, top, size: O(1)
 //   pop, push, merge: O(log N)
 // Memory Complexity: O(N)
-template <class Value, class Comparator = less<Value>> struct LeftistHeap {
+template <class Value, class Comparator = less<Value>, class Alloc = allocator<Value>> struct LeftistHeap {
+    struct Node; using NodeAlloc = typename allocator_traits<Alloc>::template rebind_alloc<Node>;
+    struct Deleter : public NodeAlloc {
+        Deleter(const NodeAlloc &a = NodeAlloc()) : NodeAlloc(a) {}
+        void operator () (Node *x) { x->~Node(); this->deallocate(x, 1); }
+    };
+    using ptr = unique_ptr<Node, Deleter>;
     struct Node {
-        Value val; int dist; unique_ptr<Node> l, r; Node(const Value &v) : val(v), dist(0) {}
+        Value val; int dist; ptr l, r; Node(const Value &v) : val(v), dist(0) {}
     };
-    Comparator cmp; int cnt; unique_ptr<Node> root;
-    unique_ptr<Node> merge(unique_ptr<Node> a, unique_ptr<Node> b) {
+    Comparator cmp; int cnt; NodeAlloc alloc; ptr root;
+    ptr makeNode(const Value &v) { Node *x = alloc.allocate(1); new (x) Node(v); return ptr(x, Deleter(alloc)); }
+    ptr merge(ptr a, ptr b) {
         if (!a || !b) return a ? move(a) : move(b);
         if (cmp(a->val, b->val)) a.swap(b);
         a->r = merge(move(a->r), move(b));
         if (!a->l || a->l->dist < a->r->dist) a->l.swap(a->r);
-        a->dist = (a->r ? a->r->dist : 0) + 1; return move(a);
+        a->dist = (a->r ? a->r->dist : 0) + 1; return a;
     }
-    LeftistHeap() : cnt(0) {}
+    LeftistHeap(const Alloc &alloc = Alloc()) : cnt(0), alloc(alloc), root(nullptr, Deleter(this->alloc)) {}
     bool empty() const { return !root; }
     Value top() const { return root->val; }
     Value pop() { Value ret = root->val; root = merge(move(root->l), move(root->r)); cnt--; return ret; }
-    void push(const Value &val) { root = merge(move(root), make_unique<Node>(val)); cnt++; }
+    void push(const Value &val) { root = merge(move(root), makeNode(val)); cnt++; }
     void merge(LeftistHeap &h) { root = merge(move(root), move(h.root)); cnt += h.cnt; }
     int size() const { return cnt; }
 };
@@ -0,0 +1,151 @@
+#pragma once
+#include <bits/stdc++.h>
+#include "../../../search/BinarySearch.h"
+#include "../../../utils/ThreadPool.h"
+#include "WaveletMatrix.h"
+using namespace std;
+
+// Merge Sort Tree with fractional cascading supporting select and rank
+//   operations for a subarray, where only the fully sorted array is stored,
+//   and each level of the tree is a single BitVector marking which elements
+//   of each merged block came from the right child, so that the number of
+//   elements less than a value in a child is found from the parent with a
+//   rank query instead of a binary search
+// Level k of the tree consists of the blocks [i 2^k, (i + 1) 2^k), and ties
+//   are broken by index; levels below LG are not stored, and blocks of
+//   size 2^LG are scanned using the index of each element in the sorted
+//   array instead
+// select finds the kth smallest element in the subarray [l, r]
+// rank finds the index of the element v if the subarray [l, r] was sorted
+// count counts the number of elements in the subarray [l, r] in the
+//   range [lo, hi]
+// Indices are 0-indexed and ranges are inclusive with the exception of
+//   functions that accept two iterators as a parameter, such as
+//   the constructor, which are exclusive
+// Constructor Arguments:
+//   N: the size of the array
+//   f: a generator function that returns the ith element on the ith call
+//   st: an iterator pointing to the first element in the array
+//   en: an iterator pointing to after the last element in the array
+//   pool: a ThreadPool used to build each level in parallel, where each
+//     merge is split between threads by binary searching for the split
+//     point of each chunk of the merged block
+// In practice, has a moderate constant, is faster than Merge Sort Trees for
+//   both rank and select queries, and uses much less memory
+// Time Complexity:
+//   constructor: O(N log N)
+//   rank, count: O(log N + 2^LG)
+//   select: O(log N (log N + 2^LG))
+// Memory Complexity: O(N) words and about 1.25 N (ceil(lg N) - LG) bits
+// Tested:
+//   Stress Tested
+template <class T, class Comparator = less<T>>
+struct FractionalCascadingMergeSortTree {
+  static constexpr int LG = 6;
+  Comparator cmp; int N, H, L; vector<T> sorted; vector<int> rnk;
+  vector<BitVector> B;
+  bool lt(const pair<T, int> &a, const pair<T, int> &b) const {
+    return cmp(a.first, b.first);
+  }
+  void mergeLevel(int k, const vector<pair<T, int>> &cur,
+                  vector<pair<T, int>> &nxt, int s, int e) {
+    BitVector &b = B[k]; for (int pos = s; pos < e; ) {
+      int bs = pos >> k << k, be = min(N, bs + (1 << k));
+      int m = min(be, bs + (1 << (k - 1))), nl = m - bs, nr = be - m;
+      int t = pos - bs, lo = max(0, t - nr), hi = min(t, nl);
+      while (lo < hi) {
+        int mid = lo + (hi - lo + 1) / 2;
+        if (lt(cur[m + t - mid], cur[bs + mid - 1])) hi = mid - 1;
+        else lo = mid;
+      }
+      int i = bs + lo, j = m + t - lo, en = min(e, be);
+      for (; pos < en; pos++) {
+        if (j < be && (i == m || lt(cur[j], cur[i]))) {
+          b.set(pos); nxt[pos] = cur[j++];
+        } else nxt[pos] = cur[i++];
+      }
+    }
+  }
+  template <class F> void build(F f, ThreadPool *pool) {
+    vector<pair<T, int>> cur, nxt; cur.reserve(N);
+    for (int i = 0; i < N; i++) cur.emplace_back(f(), i);
+    while ((1 << H) < N) H++;
+    L = H < LG ? H : LG; nxt = cur; B.assign(H + 1, BitVector(0));
+    auto cmpPair = [&] (const pair<T, int> &a, const pair<T, int> &b) {
+      return lt(a, b);
+    };
+    parallelFor(pool, (N + (1 << L) - 1) >> L, [&] (int, long long lo,
+                                                    long long hi) {
+      for (int i = lo; i < hi; i++)
+        stable_sort(cur.begin() + (i << L),
+                    cur.begin() + min(N, (i + 1) << L), cmpPair);
+    }, 64);
+    for (int k = L + 1; k <= H; k++) {
+      B[k] = BitVector(N);
+      parallelFor(pool, (N + 255) / 256, [&] (int, long long lo,
+                                              long long hi) {
+        mergeLevel(k, cur, nxt, lo * 256, min(N, int(hi * 256)));
+      }, 64);
+      B[k].build(); cur.swap(nxt);
+    }
+    vector<pair<T, int>>().swap(nxt); sorted.resize(N); rnk.resize(N);
+    parallelFor(pool, N, [&] (int, long long lo, long long hi) {
+      for (int i = lo; i < hi; i++) {
+        sorted[i] = cur[i].first; rnk[cur[i].second] = i;
+      }
+    }, 64);
+  }
+  template <class F> FractionalCascadingMergeSortTree(int N, F f)
+      : N(N), H(0) {
+    build(f, nullptr);
+  }
+  template <class F>
+  FractionalCascadingMergeSortTree(int N, F f, ThreadPool &pool)
+      : N(N), H(0) {
+    build(f, &pool);
+  }
+  template <class It> FractionalCascadingMergeSortTree(It st, It en)
+      : FractionalCascadingMergeSortTree(en - st, [&] { return *st++; }) {}
+  template <class It>
+  FractionalCascadingMergeSortTree(It st, It en, ThreadPool &pool)
+      : FractionalCascadingMergeSortTree(en - st, [&] { return *st++; },
+                                         pool) {}
+  int countPrefix(int l, int r, int p) const {
+    int ret = 0, cnt = 1, bs[2] = {0, 0}, q[2] = {p, 0}; r++;
+    if (l == 0 && r == N) return p;
+    for (int k = H; k > L && cnt > 0; k--) {
+      int nbs[2], nq[2], ncnt = 0, h = 1 << (k - 1);
+      for (int i = 0; i < cnt; i++) {
+        int pl = B[k].rank0(bs[i] + q[i]) - bs[i] / 2;
+        int cbs[2] = {bs[i], bs[i] + h}, cq[2] = {pl, q[i] - pl};
+        for (int j = 0; j < 2; j++) {
+          int be = min(N, cbs[j] + h);
+          if (cq[j] == 0 || r <= cbs[j] || be <= l) continue;
+          if (l <= cbs[j] && be <= r) ret += cq[j];
+          else { nbs[ncnt] = cbs[j]; nq[ncnt++] = cq[j]; }
+        }
+      }
+      cnt = ncnt;
+      for (int i = 0; i < cnt; i++) { bs[i] = nbs[i]; q[i] = nq[i]; }
+    }
+    for (int i = 0; i < cnt; i++) {
+      int en = min(r, bs[i] + (1 << L));
+      for (int j = max(l, bs[i]); j < en; j++) ret += rnk[j] < p;
+    }
+    return ret;
+  }
+  T select(int l, int r, int k) const {
+    return sorted[bsearch<FIRST>(0, N, [&] (int p) {
+      return countPrefix(l, r, p + 1) > k;
+    })];
+  }
+  int rank(int l, int r, const T &v) const {
+    return countPrefix(l, r, lower_bound(sorted.begin(), sorted.end(), v, cmp)
+                                 - sorted.begin());
+  }
+  int count(int l, int r, const T &lo, const T &hi) const {
+    if (cmp(hi, lo)) return 0;
+    return countPrefix(l, r, upper_bound(sorted.begin(), sorted.end(), hi, cmp)
+                                 - sorted.begin()) - rank(l, r, lo);
+  }
+};
@@ -1,5 +1,6 @@
 #pragma once
 #include <bits/stdc++.h>
+#include "../../../utils/NodeArena.h"
 using namespace std;
 
 // Top down segment tree supporting point updates and range queries,
@@ -156,6 +157,11 @@ template <const bool LAZY, class Combine> struct SegmentTreeTopDown {
 //     return k;
 //   }
 // };
+// The nodes are stored in TR, an arena with the same interface as NodeArena
+//   (the default), and are referenced by 32-bit indices where 0 is null
+// If PERSISTENT is true and LAZY is false, every version created after
+//   a call to TR.mark() can be discarded at once by removing their roots
+//   and rewinding TR to that mark
 // Time Complexity:
 //   constructor: O(1) for size constructor,
 //                O(N) for iteartor and generating function constructors
@@ -173,75 +179,78 @@ template <const bool LAZY, class Combine> struct SegmentTreeTopDown {
 //   https://codeforces.com/gym/101982/problem/F
 //     (LAZY = true, PERSISTENT = false)
 //   https://www.spoj.com/problems/TTM/ (LAZY = true, PERSISTENT = true)
+//   Fuzz Tested
 template <class IndexType, const bool LAZY, const bool PERSISTENT,
-          class Combine> struct DynamicSegmentTree {
+          class Combine, template <class> class Arena = NodeArena>
+struct DynamicSegmentTree {
 #define lazy_def template <const bool _ = LAZY> typename enable_if<_>::type
 #define agg_def template <const bool _ = LAZY> typename enable_if<!_>::type
   static_assert(is_integral<IndexType>::value, "IndexType must be integeral");
   using Data = typename Combine::Data; using Lazy = typename Combine::Lazy;
-  Combine C; IndexType N;
-  vector<int> L, R, roots; vector<Data> TR; vector<Lazy> LZ;
-  lazy_def pushBackLazy(int cp) { LZ.push_back(~cp ? LZ[cp] : C.ldef); }
-  agg_def pushBackLazy(int) {}
+  struct AggNode { Data val; int l, r; };
+  struct LazyNode : public AggNode { Lazy lz; };
+  using Node = typename conditional<LAZY, LazyNode, AggNode>::type;
+  Combine C; IndexType N; vector<int> roots; Arena<Node> TR;
+  lazy_def clearLazy(Node &n) { n.lz = C.ldef; }
+  agg_def clearLazy(Node &) {}
   int makeNode(int cp, IndexType tl, IndexType tr) {
-    if (~cp) { L.push_back(L[cp]); R.push_back(R[cp]); TR.push_back(TR[cp]); }
+    Node n; if (cp) n = TR[cp];
     else {
-      L.push_back(-1); R.push_back(-1);
-      TR.push_back(C.getSegmentVdef(tr - tl + 1));
+      n.val = C.getSegmentVdef(tr - tl + 1); n.l = n.r = 0; clearLazy(n);
     }
-    pushBackLazy(cp); return int(TR.size()) - 1;
+    return TR.make(n);
   }
   lazy_def propagate(int x, IndexType tl, IndexType tr) {
-    if (LZ[x] != C.ldef) {
-      IndexType m = tl + (tr - tl) / 2;
-      if (!~L[x] || PERSISTENT) {
-        int nl = makeNode(L[x], tl, m); L[x] = nl;
+    if (TR[x].lz != C.ldef) {
+      IndexType m = tl + (tr - tl) / 2; Lazy v = TR[x].lz;
+      if (!TR[x].l || PERSISTENT) {
+        int nl = makeNode(TR[x].l, tl, m); TR[x].l = nl;
       }
-      TR[L[x]] = C.applyLazy(TR[L[x]], C.getSegmentVal(LZ[x], m - tl + 1));
-      LZ[L[x]] = C.mergeLazy(LZ[L[x]], LZ[x]);
-      if (!~R[x] || PERSISTENT) {
-        int nr = makeNode(R[x], m + 1, tr); R[x] = nr;
+      apply(TR[x].l, tl, m, v);
+      if (!TR[x].r || PERSISTENT) {
+        int nr = makeNode(TR[x].r, m + 1, tr); TR[x].r = nr;
       }
-      TR[R[x]] = C.applyLazy(TR[R[x]], C.getSegmentVal(LZ[x], tr - m));
-      LZ[R[x]] = C.mergeLazy(LZ[R[x]], LZ[x]); LZ[x] = C.ldef;
+      apply(TR[x].r, m + 1, tr, v); TR[x].lz = C.ldef;
     }
   }
   agg_def propagate(int, IndexType, IndexType) {}
   lazy_def apply(int x, IndexType tl, IndexType tr, const Lazy &v) {
-    TR[x] = C.applyLazy(TR[x], C.getSegmentVal(v, tr - tl + 1));
-    LZ[x] = C.mergeLazy(LZ[x], v);
+    Node &n = TR[x]; n.lz = C.mergeLazy(n.lz, v);
+    n.val = C.applyLazy(n.val, C.getSegmentVal(v, tr - tl + 1));
   }
   agg_def apply(int x, IndexType, IndexType, const Lazy &v) {
-    TR[x] = C.applyLazy(TR[x], v);
+    TR[x].val = C.applyLazy(TR[x].val, v);
   }
   template <class F> int build(IndexType tl, IndexType tr, F &f) {
-    int x = makeNode(-1, tl, tr);
-    if (tl == tr) { TR[x] = f(); return x; }
-    IndexType m = tl + (tr - tl) / 2; int nl = build(tl, m, f); L[x] = nl;
-    int nr = build(m + 1, tr, f); R[x] = nr;
-    TR[x] = C.merge(TR[L[x]], TR[R[x]]); return x;
+    int x = makeNode(0, tl, tr);
+    if (tl == tr) { TR[x].val = f(); return x; }
+    IndexType m = tl + (tr - tl) / 2; int nl = build(tl, m, f); TR[x].l = nl;
+    int nr = build(m + 1, tr, f); TR[x].r = nr;
+    TR[x].val = C.merge(TR[nl].val, TR[nr].val); return x;
   }
   int update(int y, IndexType tl, IndexType tr, IndexType l, IndexType r,
              const Lazy &v, int trSz) {
-    int x = !~y || (PERSISTENT && y < trSz) ? makeNode(y, tl, tr) : y;
+    int x = !y || (PERSISTENT && y <= trSz) ? makeNode(y, tl, tr) : y;
     if (l <= tl && tr <= r) { apply(x, tl, tr, v); return x; }
     propagate(x, tl, tr); IndexType m = tl + (tr - tl) / 2;
     if (tl <= r && l <= m) {
-      int nl = update(L[x], tl, m, l, r, v, trSz); L[x] = nl;
+      int nl = update(TR[x].l, tl, m, l, r, v, trSz); TR[x].l = nl;
     }
     if (m + 1 <= r && l <= tr) {
-      int nr = update(R[x], m + 1, tr, l, r, v, trSz); R[x] = nr;
+      int nr = update(TR[x].r, m + 1, tr, l, r, v, trSz); TR[x].r = nr;
     }
-    TR[x] = C.merge(~L[x] ? TR[L[x]] : C.getSegmentVdef(m - tl + 1),
-                    ~R[x] ? TR[R[x]] : C.getSegmentVdef(tr - m));
+    int nl = TR[x].l, nr = TR[x].r;
+    TR[x].val = C.merge(nl ? TR[nl].val : C.getSegmentVdef(m - tl + 1),
+                        nr ? TR[nr].val : C.getSegmentVdef(tr - m));
     return x;
   }
   Data query(int x, IndexType tl, IndexType tr, IndexType l, IndexType r) {
     if (r < tl || tr < l) return C.qdef;
-    if (!~x) return C.getSegmentVdef(tr - tl + 1);
-    if (l <= tl && tr <= r) return TR[x];
+    if (!x) return C.getSegmentVdef(min(r, tr) - max(l, tl) + 1);
+    if (l <= tl && tr <= r) return TR[x].val;
     propagate(x, tl, tr); IndexType m = tl + (tr - tl) / 2;
-    return C.merge(query(L[x], tl, m, l, r), query(R[x], m + 1, tr, l, r));
+    int nl = TR[x].l, nr = TR[x].r;
+    return C.merge(query(nl, tl, m, l, r), query(nr, m + 1, tr, l, r));
   }
   template <class F> DynamicSegmentTree(IndexType N, F f) : N(N) {
     if (N > 0) {
@@ -250,7 +259,7 @@ template <class IndexType, const bool LAZY, const bool PERSISTENT,
   }
   template <class It> DynamicSegmentTree(It st, It en)
       : DynamicSegmentTree(en - st, [&] { return *st++; }) {}
-  DynamicSegmentTree(IndexType N) : N(N) { roots.push_back(-1); }
+  DynamicSegmentTree(IndexType N) : N(N) { roots.push_back(0); }
   lazy_def update(IndexType l, IndexType r, const Lazy &v, bool newRoot) {
     int nr = update(roots.back(), 0, N - 1, l, r, v, TR.size());
     if (newRoot) roots.push_back(nr);
@@ -265,9 +274,7 @@ template <class IndexType, const bool LAZY, const bool PERSISTENT,
     return query(~rootInd ? roots[rootInd] : roots.back(), 0, N - 1, l, r);
   }
   void revert(int rootInd) { roots.push_back(roots[rootInd]); }
-  void reserveNodes(int k) {
-    L.reserve(k); R.reserve(k); TR.reserve(k); if (LAZY) LZ.reserve(k);
-  }
+  void reserveNodes(int k) { TR.reserve(k); }
 #undef lazy_def
 #undef agg_def
 };
@@ -0,0 +1,180 @@
+#pragma once
+#include <bits/stdc++.h>
+using namespace std;
+
+// Persistent top down segment tree supporting range updates and range
+//   queries from a single writer thread, while any number of reader threads
+//   query consistent snapshots of the tree without any locks
+// Each update copies the nodes on its path (and the children that lazy
+//   values are pushed to), so that older versions remain unchanged, and the
+//   new root is then published atomically
+// Queries never modify the tree, and instead accumulate the lazy values of
+//   the ancestors of each node
+// The nodes are stored in a pool of chunks that never move, and each reader
+//   announces the version of its snapshot in its own slot, so that the nodes
+//   replaced by an update are reused once every snapshot that could reach
+//   them has been released (epoch based reclamation)
+// Indices are 0-indexed and ranges are inclusive with the exception of
+//   functions that accept two iterators as a parameter, such as
+//   the constructor, which are exclusive
+// A combine struct is provided as a template parameter
+//   with typedefs/using for data and lazy,
+//   a query default value (qdef), lazy default value (ldef),
+//   and implementations of merge, applyLazy, getSegmentVal, and mergeLazy,
+//   as in SegmentTreeTopDown
+// merge, applyLazy, and mergeLazy must all be associative, and applying two
+//   lazy values one after another must have the same effect as applying
+//   their merged value
+// Below is a sample struct for range assignment and range sum queries
+// struct Combine {
+//   using Data = int;
+//   using Lazy = int;
+//   const Data qdef = 0;
+//   const Lazy ldef = numeric_limits<int>::min();
+//   Data merge(const Data &l, const Data &r) const { return l + r; }
+//   Data applyLazy(const Data &l, const Lazy &r) const { return r; }
+//   Lazy getSegmentVal(const Lazy &v, int k) const { return v * k; }
+//   Lazy mergeLazy(const Lazy &l, const Lazy &r) const { return r; }
+// };
+// Constructor Arguments:
+//   N: the number of elements
+//   f: a generating function that returns the i-th element on the i-th call
+//   st: an iterator pointing to the first element
+//   en: an iterator pointing to after the last element
+//   vdef: the default value of each element
+//   R: the number of readers that can hold a snapshot at the same time
+// Functions (writer thread only):
+//   update(l, r, v): updates the range [l, r] with the lazy value v,
+//     creating a new version
+//   query(l, r): returns the aggregate value of the range [l, r] in the
+//     latest version
+// Functions (any thread):
+//   snapshot(k): returns a Snapshot of the latest version for reader k,
+//     which must be in the range [0, R), where each reader can only hold one
+//     snapshot at a time; the snapshot supports query(l, r) and version(),
+//     and is released when it is destroyed
+// In practice, has a moderate constant, and readers never wait for the
+//   writer or for each other
+// Time Complexity:
+//   constructor: O(N + R)
+//   update: O(log N + R) amortized
+//   query, Snapshot::query: O(log N)
+//   snapshot: O(1), retrying only if an update is published during the call
+// Memory Complexity: O(N + R + U log N) for U updates made while the oldest
+//   unreleased snapshot was taken
+// Tested:
+//   Fuzz and Stress Tested
+template <class Combine> struct SnapshotSegmentTree {
+  using Data = typename Combine::Data; using Lazy = typename Combine::Lazy;
+  static constexpr int LGC = 16, CHUNK = 1 << LGC, MAXC = 1 << 14;
+  static constexpr long long FREE = LLONG_MAX;
+  struct Node { Data val; Lazy lz; int l, r; long long ver; };
+  struct Snapshot {
+    SnapshotSegmentTree *T; int k, root; long long ver;
+    Snapshot(SnapshotSegmentTree *T, int k, int root, long long ver)
+        : T(T), k(k), root(root), ver(ver) {}
+    Snapshot(Snapshot &&s) : T(s.T), k(s.k), root(s.root), ver(s.ver) {
+      s.T = nullptr;
+    }
+    Snapshot(const Snapshot &) = delete;
+    Snapshot &operator = (const Snapshot &) = delete;
+    ~Snapshot() {
+      if (T) __atomic_store_n(&T->slots[k], FREE, __ATOMIC_RELEASE);
+    }
+    Data query(int l, int r) const {
+      return T->query(root, 0, T->N - 1, l, r, T->C.ldef);
+    }
+    long long version() const { return ver; }
+  };
+  Combine C; int N, root, cnt; long long ver;
+  vector<unique_ptr<Node[]>> chunks; vector<int> freeNodes;
+  vector<long long> slots; deque<pair<long long, vector<int>>> retired;
+  Node &node(int x) const { return chunks[x >> LGC][x & (CHUNK - 1)]; }
+  int makeNode() {
+    if (!freeNodes.empty()) {
+      int x = freeNodes.back(); freeNodes.pop_back(); return x;
+    }
+    if ((cnt & (CHUNK - 1)) == 0) {
+      if ((cnt >> LGC) == MAXC) throw runtime_error("Out of nodes");
+      chunks[cnt >> LGC].reset(new Node[CHUNK]);
+    }
+    return cnt++;
+  }
+  int copy(int x, vector<int> &old) {
+    if (node(x).ver == ver + 1) return x;
+    int y = makeNode(); node(y) = node(x); node(y).ver = ver + 1;
+    old.push_back(x); return y;
+  }
+  Lazy compose(const Lazy &l, const Lazy &r) const {
+    return l == C.ldef ? r : r == C.ldef ? l : C.mergeLazy(l, r);
+  }
+  void apply(int x, int tl, int tr, const Lazy &v) {
+    Node &n = node(x); n.lz = compose(n.lz, v);
+    n.val = C.applyLazy(n.val, C.getSegmentVal(v, tr - tl + 1));
+  }
+  template <class F> int build(int tl, int tr, F &f) {
+    int x = makeNode(); node(x).lz = C.ldef; node(x).ver = 0;
+    if (tl == tr) {
+      node(x).val = f(); node(x).l = node(x).r = -1; return x;
+    }
+    int m = tl + (tr - tl) / 2, l = build(tl, m, f), r = build(m + 1, tr, f);
+    node(x).l = l; node(x).r = r;
+    node(x).val = C.merge(node(l).val, node(r).val); return x;
+  }
+  int update(int x, int tl, int tr, int l, int r, const Lazy &v,
+             vector<int> &old) {
+    x = copy(x, old);
+    if (l <= tl && tr <= r) { apply(x, tl, tr, v); return x; }
+    Node &n = node(x); int m = tl + (tr - tl) / 2; if (n.lz != C.ldef) {
+      n.l = copy(n.l, old); n.r = copy(n.r, old);
+      apply(n.l, tl, m, n.lz); apply(n.r, m + 1, tr, n.lz); n.lz = C.ldef;
+    }
+    if (tl <= r && l <= m) n.l = update(n.l, tl, m, l, r, v, old);
+    if (m + 1 <= r && l <= tr) n.r = update(n.r, m + 1, tr, l, r, v, old);
+    n.val = C.merge(node(n.l).val, node(n.r).val); return x;
+  }
+  Data query(int x, int tl, int tr, int l, int r, const Lazy &acc) const {
+    if (r < tl || tr < l) return C.qdef;
+    const Node &n = node(x); if (l <= tl && tr <= r) return acc == C.ldef
+        ? n.val : C.applyLazy(n.val, C.getSegmentVal(acc, tr - tl + 1));
+    int m = tl + (tr - tl) / 2; Lazy a = compose(n.lz, acc);
+    return C.merge(query(n.l, tl, m, l, r, a),
+                   query(n.r, m + 1, tr, l, r, a));
+  }
+  void reclaim() {
+    long long mn = ver;
+    for (auto &&s : slots)
+      mn = min(mn, __atomic_load_n(&s, __ATOMIC_SEQ_CST));
+    for (; !retired.empty() && retired.front().first <= mn;
+         retired.pop_front()) {
+      vector<int> &old = retired.front().second;
+      freeNodes.insert(freeNodes.end(), old.begin(), old.end());
+    }
+  }
+  template <class F> SnapshotSegmentTree(int N, F f, int R = 1)
+      : N(N), root(-1), cnt(0), ver(0), chunks(MAXC), slots(R, FREE) {
+    if (N > 0) root = build(0, N - 1, f);
+  }
+  template <class It> SnapshotSegmentTree(It st, It en, int R = 1)
+      : SnapshotSegmentTree(en - st, [&] { return *st++; }, R) {}
+  SnapshotSegmentTree(int N, const Data &vdef, int R = 1)
+      : SnapshotSegmentTree(N, [&] { return vdef; }, R) {}
+  void update(int l, int r, const Lazy &v) {
+    vector<int> old; int nr = update(root, 0, N - 1, l, r, v, old);
+    retired.emplace_back(ver + 1, move(old));
+    __atomic_store_n(&root, nr, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&ver, ver + 1, __ATOMIC_SEQ_CST); reclaim();
+  }
+  Data query(int l, int r) const {
+    return query(root, 0, N - 1, l, r, C.ldef);
+  }
+  Snapshot snapshot(int k) {
+    while (true) {
+      long long v = __atomic_load_n(&ver, __ATOMIC_SEQ_CST);
+      __atomic_store_n(&slots[k], v, __ATOMIC_SEQ_CST);
+      int r = __atomic_load_n(&root, __ATOMIC_SEQ_CST);
+      if (__atomic_load_n(&ver, __ATOMIC_SEQ_CST) == v)
+        return Snapshot(this, k, r, node(r).ver);
+    }
+  }
+};
@@ -0,0 +1,196 @@
+#pragma once
+#include <bits/stdc++.h>
+using namespace std;
+
+// Bit vector supporting rank and select queries, where each block of 256
+//   bits is stored together with the number of set bits before it, using
+//   about 1.25 bits per element
+// Indices are 0-indexed
+// Constructor Arguments:
+//   N: the number of bits, which are all initially 0
+// Functions:
+//   set(i): sets the bit at index i to 1, and must be followed by a call to
+//     build before any query
+//   build(): computes the counts of each block
+//   get(i): returns the bit at index i
+//   rank1(i), rank0(i): returns the number of 1s or 0s in the range [0, i)
+//   select1(k), select0(k): returns the index of the kth 1 or 0 (0-indexed),
+//     or N if it does not exist
+// In practice, rank has a very small constant, especially when compiled
+//   with hardware popcount support (such as with -mpopcnt)
+// Time Complexity:
+//   constructor, build: O(N / 64)
+//   set, get, rank1, rank0: O(1)
+//   select1, select0: O(log N)
+// Memory Complexity: about 1.25N bits
+// Tested:
+//   Fuzz and Stress Tested
+struct BitVector {
+  struct Block { unsigned cnt; uint64_t w[4]; };
+  int N; vector<Block> B;
+  BitVector(int N = 0) : N(N), B(N / 256 + 1, Block{0, {0, 0, 0, 0}}) {}
+  void set(int i) { B[i >> 8].w[(i >> 6) & 3] |= uint64_t(1) << (i & 63); }
+  void build() {
+    unsigned c = 0; for (auto &&b : B) {
+      b.cnt = c; for (auto &&w : b.w) c += __builtin_popcountll(w);
+    }
+  }
+  bool get(int i) const { return B[i >> 8].w[(i >> 6) & 3] >> (i & 63) & 1; }
+  int rank1(int i) const {
+    const Block &b = B[i >> 8]; int j = (i >> 6) & 3, ret = b.cnt;
+    for (int k = 0; k < j; k++) ret += __builtin_popcountll(b.w[k]);
+    return ret + __builtin_popcountll(
+        b.w[j] & ((uint64_t(1) << (i & 63)) - 1));
+  }
+  int rank0(int i) const { return i - rank1(i); }
+  template <const bool ONE> int select(int k) const {
+    auto ones = [&] (int b) {
+      return ONE ? int(B[b].cnt) : b * 256 - int(B[b].cnt);
+    };
+    int lo = 0, hi = B.size();
+    while (hi - lo > 1) {
+      int mid = lo + (hi - lo) / 2;
+      if (ones(mid) <= k) lo = mid;
+      else hi = mid;
+    }
+    k -= ones(lo); for (int j = 0; j < 4; j++) {
+      uint64_t w = ONE ? B[lo].w[j] : ~B[lo].w[j];
+      int c = __builtin_popcountll(w); if (k >= c) { k -= c; continue; }
+      for (; k > 0; k--) w &= w - 1;
+      return min(N, lo * 256 + j * 64 + __builtin_ctzll(w));
+    }
+    return N;
+  }
+  int select1(int k) const { return k < 0 ? N : select<true>(k); }
+  int select0(int k) const { return k < 0 ? N : select<false>(k); }
+};
+
+// Wavelet Matrix supporting select and rank operations for a subarray,
+//   where the values are compressed to the range [0, M) for M distinct
+//   values, and each of the ceil(lg M) levels is a BitVector of the bits of
+//   the values, stably partitioned by the bits of the previous levels
+// select finds the kth smallest element in the subarray [l, r]
+// rank finds the index of the element v if the subarray [l, r] was sorted
+// count counts the number of elements in the subarray [l, r] in the
+//   range [lo, hi]
+// below, floor, ceiling, above return a pointer to the last element less
+//   than v, the last element not greater than v, the first element not less
+//   than v, and the first element greater than v respectively in the
+//   subarray [l, r], or null if it does not exist
+// at returns the element at index i
+// indexOf returns the index of the kth (0-indexed) occurrence of v in the
+//   array, or -1 if it does not exist
+// Indices are 0-indexed and ranges are inclusive with the exception of
+//   functions that accept two iterators as a parameter, such as
+//   the constructor, which are exclusive
+// In practice, has a small constant, and is faster than Wavelet Trees and
+//   Merge Sort Trees for both rank and select queries, while using
+//   O(N log M) bits instead of O(N log N) words
+// Time Complexity:
+//   constructor: O(N log M)
+//   rank, count, select, below, floor, ceiling, above, at: O(log M)
+//   indexOf: O(log M log N)
+// Memory Complexity: O(M) words and about 1.25 N ceil(lg M) bits
+// Tested:
+//   Fuzz and Stress Tested
+template <class T, class Comparator = less<T>> struct WaveletMatrix {
+  Comparator cmp; int N, H; vector<T> vals; vector<BitVector> B;
+  vector<int> Z;
+  template <class F> WaveletMatrix(int N, F f) : N(N), H(0) {
+    vector<T> A; A.reserve(N); for (int i = 0; i < N; i++) A.push_back(f());
+    vals = A; sort(vals.begin(), vals.end(), cmp);
+    vals.erase(unique(vals.begin(), vals.end(),
+                      [&] (const T &a, const T &b) {
+                        return !cmp(a, b) && !cmp(b, a);
+                      }), vals.end());
+    vals.shrink_to_fit();
+    while ((1 << H) < int(vals.size())) H++;
+    vector<int> cur(N), nxt(N);
+    for (int i = 0; i < N; i++) cur[i] = index(A[i]);
+    vector<T>().swap(A); B.assign(H, BitVector(N)); Z.assign(H, 0);
+    for (int h = H - 1; h >= 0; h--) {
+      BitVector &b = B[h]; int z = 0;
+      for (int i = 0; i < N; i++) {
+        if (cur[i] >> h & 1) b.set(i);
+        else z++;
+      }
+      b.build(); Z[h] = z; int p0 = 0, p1 = z;
+      for (int i = 0; i < N; i++)
+        nxt[cur[i] >> h & 1 ? p1++ : p0++] = cur[i];
+      swap(cur, nxt);
+    }
+  }
+  template <class It> WaveletMatrix(It st, It en)
+      : WaveletMatrix(en - st, [&] { return *st++; }) {}
+  int index(const T &v) const {
+    return lower_bound(vals.begin(), vals.end(), v, cmp) - vals.begin();
+  }
+  int countLess(int l, int r, int c) const {
+    if (c >= (1 << H)) return r - l;
+    int ret = 0; for (int h = H - 1; h >= 0; h--) {
+      const BitVector &b = B[h]; int l0 = b.rank0(l), r0 = b.rank0(r);
+      if (c >> h & 1) { ret += r0 - l0; l += Z[h] - l0; r += Z[h] - r0; }
+      else { l = l0; r = r0; }
+    }
+    return ret;
+  }
+  int selectIndex(int l, int r, int k) const {
+    int c = 0; for (int h = H - 1; h >= 0; h--) {
+      const BitVector &b = B[h]; int l0 = b.rank0(l), r0 = b.rank0(r);
+      if (k < r0 - l0) { l = l0; r = r0; }
+      else { k -= r0 - l0; c |= 1 << h; l += Z[h] - l0; r += Z[h] - r0; }
+    }
+    return c;
+  }
+  T select(int l, int r, int k) const {
+    return vals[selectIndex(l, r + 1, k)];
+  }
+  int rank(int l, int r, const T &v) const {
+    return countLess(l, r + 1, index(v));
+  }
+  int count(int l, int r, const T &lo, const T &hi) const {
+    int a = index(lo), b = upper_bound(vals.begin(), vals.end(), hi, cmp)
+        - vals.begin();
+    return a >= b ? 0 : countLess(l, r + 1, b) - countLess(l, r + 1, a);
+  }
+  const T *below(int l, int r, const T &v) const {
+    int c = countLess(l, r + 1, index(v));
+    return c == 0 ? nullptr : &vals[selectIndex(l, r + 1, c - 1)];
+  }
+  const T *floor(int l, int r, const T &v) const {
+    int c = countLess(l, r + 1, upper_bound(vals.begin(), vals.end(), v, cmp)
+                                    - vals.begin());
+    return c == 0 ? nullptr : &vals[selectIndex(l, r + 1, c - 1)];
+  }
+  const T *ceiling(int l, int r, const T &v) const {
+    int c = countLess(l, r + 1, index(v));
+    return c == r - l + 1 ? nullptr : &vals[selectIndex(l, r + 1, c)];
+  }
+  const T *above(int l, int r, const T &v) const {
+    int c = countLess(l, r + 1, upper_bound(vals.begin(), vals.end(), v, cmp)
+                                    - vals.begin());
+    return c == r - l + 1 ? nullptr : &vals[selectIndex(l, r + 1, c)];
+  }
+  T at(int i) const {
+    int c = 0; for (int h = H - 1; h >= 0; h--) {
+      if (B[h].get(i)) { c |= 1 << h; i = Z[h] + B[h].rank1(i); }
+      else i = B[h].rank0(i);
+    }
+    return vals[c];
+  }
+  int indexOf(const T &v, int k) const {
+    int c = index(v);
+    if (c == int(vals.size()) || cmp(v, vals[c]) || k < 0) return -1;
+    int l = 0, r = N; for (int h = H - 1; h >= 0; h--) {
+      const BitVector &b = B[h]; int l0 = b.rank0(l), r0 = b.rank0(r);
+      if (c >> h & 1) { l += Z[h] - l0; r += Z[h] - r0; }
+      else { l = l0; r = r0; }
+    }
+    if (l + k >= r) return -1;
+    int i = l + k; for (int h = 0; h < H; h++) {
+      if (c >> h & 1) i = B[h].select1(i - Z[h]);
+      else i = B[h].select0(i);
+    }
+    return i;
+  }
+};
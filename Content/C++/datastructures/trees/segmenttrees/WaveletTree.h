@@ -12,7 +12,8 @@ using namespace std;
 //   functions that accept two iterators as a parameter, such as
 //   the constructor, which are exclusive
 // In practice, has a moderate constant, slower than Merge Sort Trees for
-//   rank queries, but much faster for select queries
+//   rank queries, but much faster for select queries, and uses much more
+//   memory than the Wavelet Matrix in WaveletMatrix.h, which is also faster
 // Time Complexity:
 //   constructor, rank, select: O(N log N)
 // Memory Complexity: O(N log N)
@@ -0,0 +1,94 @@
+#pragma once
+#include <bits/stdc++.h>
+using namespace std;
+
+// Lock-free Union Find / Disjoint Sets that supports concurrent calls to
+//   all functions from multiple threads
+// Each set is linked to the set whose root has a higher random priority,
+//   using a compare and swap, and find uses path halving with compare and
+//   swap, so it never retries
+// The size of a root is frozen while it is being linked, and any thread
+//   adding to a frozen size waits for the link to finish
+// Indices are 0-indexed
+// Template Arguments:
+//   SIZES: whether the sizes of the sets and the number of sets are
+//     maintained; if false, getSize and getCount are not available, and
+//     join is a single compare and swap on the root
+// Constructor Arguments:
+//   N: the number of elements
+//   seed: the seed used to generate the random priorities, or a negative
+//     value to always link to the smaller root, so that the root of each set
+//     is its smallest element
+// Functions:
+//   find(v): returns the root of the set containing v at some point during
+//     the call
+//   join(v, w): merges the sets containing v and w, returning true if they
+//     were not already in the same set and false otherwise
+//   connected(v, w): returns true if v and w are in the same set and false
+//     otherwise
+//   getSize(v): returns the size of the set containing v, which is exact
+//     when no join is in progress, and may not yet include joins that are
+//     still in progress
+//   getCount(): returns the number of sets
+// In practice, has a small constant, and is slower than UnionFind when
+//   used from a single thread
+// Time Complexity:
+//   constructor: O(N)
+//   find, join, connected, getSize: O(log N) expected per operation without
+//     contention
+//   getCount: O(1)
+// Memory Complexity: O(N)
+// Tested:
+//   Fuzz and Stress Tested
+template <const bool SIZES = true> struct ConcurrentUnionFind {
+  static constexpr int FROZEN = -1;
+  vector<int> par, sz, prio; int cnt;
+  ConcurrentUnionFind(int N, long long seed = 0)
+      : par(N), sz(SIZES ? N : 0, 1), prio(seed < 0 ? 0 : N), cnt(N) {
+    iota(par.begin(), par.end(), 0); iota(prio.begin(), prio.end(), 0);
+    shuffle(prio.begin(), prio.end(), mt19937_64(max(seed, 0LL)));
+  }
+  bool lower(int v, int w) const {
+    return prio.empty() ? v > w : prio[v] < prio[w];
+  }
+  static int load(const int &x) {
+    return __atomic_load_n(&x, __ATOMIC_ACQUIRE);
+  }
+  static bool cas(int &x, int a, int b) {
+    return __sync_bool_compare_and_swap(&x, a, b);
+  }
+  int find(int v) {
+    for (int p, g; (p = load(par[v])) != v; v = g)
+      if ((g = load(par[p])) != p) cas(par[v], p, g);
+    return v;
+  }
+  void add(int v, int s) {
+    for (int r = find(v), cur;; r = find(r))
+      if ((cur = load(sz[r])) != FROZEN && cas(sz[r], cur, cur + s)) return;
+  }
+  bool join(int v, int w) {
+    while (true) {
+      if ((v = find(v)) == (w = find(w))) return false;
+      if (!lower(v, w)) swap(v, w);
+      if (!SIZES) { if (cas(par[v], v, w)) return true; continue; }
+      int s = load(sz[v]); if (s == FROZEN || !cas(sz[v], s, FROZEN)) continue;
+      __atomic_store_n(&par[v], w, __ATOMIC_RELEASE); add(w, s);
+      __sync_fetch_and_sub(&cnt, 1); return true;
+    }
+  }
+  bool connected(int v, int w) {
+    while (true) {
+      if ((v = find(v)) == (w = find(w))) return true;
+      if (load(par[v]) == v) return false;
+    }
+  }
+  int getSize(int v) {
+    static_assert(SIZES, "getSize requires SIZES to be true");
+    for (int r = find(v), s;; r = find(r))
+      if ((s = load(sz[r])) != FROZEN) return s;
+  }
+  int getCount() const {
+    static_assert(SIZES, "getCount requires SIZES to be true");
+    return load(cnt);
+  }
+};
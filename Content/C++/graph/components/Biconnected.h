@@ -4,6 +4,7 @@ using namespace std;
 
 // Computes the articulation points and bridges of a graph,
 // and decomposes the graph into biconnected components
+// The depth first searches use an explicit stack instead of recursion
 // Time Complexity: O(V + E)
 // Memory Complexity: O(V + E)
 template <const int MAXV> struct Biconnected {
@@ -16,13 +17,15 @@ template <const int MAXV> struct Biconnected {
         isBridge[v].push_back(false); isBridge[w].push_back(false);
         rev[v].push_back(int(rev[w].size())); rev[w].push_back(int(rev[v].size()) - 1);
     }
-    void dfs(int v, int prev) {
-        int children = 0; pre[v] = low[v] = cur++;
-        for (int i = 0; i < int(adj[v].size()); i++) {
-            int w = adj[v][i];
-            if (pre[w] == -1) {
-                children++; s.emplace(v, w); dfs(w, v); low[v] = min(low[v], low[w]);
-                if ((prev == v && children > 1) || (prev != v && low[w] >= pre[v])) {
+    struct Frame { int v, prev, i, children; }; vector<Frame> call; vector<int> stk;
+    void dfs(int r) {
+        pre[r] = low[r] = cur++; call.push_back({r, r, 0, 0});
+        while (!call.empty()) {
+            Frame &f = call.back(); int v = f.v;
+            if (f.i == int(adj[v].size())) {
+                call.pop_back(); if (call.empty()) break;
+                Frame &p = call.back(); v = p.v; int w = adj[v][p.i], i = p.i++; low[v] = min(low[v], low[w]);
+                if ((p.prev == v && p.children > 1) || (p.prev != v && low[w] >= pre[v])) {
                     articulation[v] = true; components.emplace_back();
                     while (s.top().first != v || s.top().second != w) {
                         components.back().push_back(s.top().first); components.back().push_back(s.top().second); s.pop();
@@ -30,19 +33,29 @@ template <const int MAXV> struct Biconnected {
                     components.back().push_back(s.top().first); components.back().push_back(s.top().second); s.pop();
                 }
                 if (low[w] == pre[w]) { isBridge[v][i] = isBridge[w][rev[v][i]] = true; }
-            } else if (w != prev && pre[w] < low[v]) { low[v] = pre[w]; s.emplace(v, w); }
+                continue;
+            }
+            int w = adj[v][f.i];
+            if (pre[w] == -1) {
+                f.children++; s.emplace(v, w); pre[w] = low[w] = cur++; call.push_back({w, v, 0, 0});
+                continue;
+            } else if (w != f.prev && pre[w] < low[v]) { low[v] = pre[w]; s.emplace(v, w); }
+            f.i++;
         }
     }
-    void dfs2(int v, int curId) {
-        id[v] = curId;
-        for (int i = 0; i < int(adj[v].size()); i++) if (id[adj[v][i]] == -1 && !isBridge[v][i]) dfs2(adj[v][i], curId);
+    void dfs2(int r, int curId) {
+        id[r] = curId; stk.push_back(r);
+        while (!stk.empty()) {
+            int v = stk.back(); stk.pop_back();
+            for (int i = 0; i < int(adj[v].size()); i++) if (id[adj[v][i]] == -1 && !isBridge[v][i]) { id[adj[v][i]] = curId; stk.push_back(adj[v][i]); }
+        }
     }
     void clear(int V = MAXV) { components.clear(); for (int i = 0; i < V; i++) { adj[i].clear(); isBridge[i].clear(); rev[i].clear(); } }
     void run(int V) {
         cur = 0;
         for (int v = 0; v < V; v++) { low[v] = pre[v] = -1; articulation[v] = false; }
         for (int v = 0; v < V; v++) {
-            if (pre[v] == -1) dfs(v, v);
+            if (pre[v] == -1) dfs(v);
             if (!s.empty()) {
                 components.emplace_back();
                 while (!s.empty()) {
@@ -0,0 +1,93 @@
+#pragma once
+#include <bits/stdc++.h>
+#include "../../datastructures/unionfind/ConcurrentUnionFind.h"
+#include "../../utils/ThreadPool.h"
+using namespace std;
+
+// Computes the connected components of a graph in parallel using a
+//   ConcurrentUnionFind without sizes that always links to the smaller root,
+//   so that the root of each component is its smallest vertex, with full
+//   path compression at the end (Shiloach-Vishkin)
+// When given a graph, the first few neighbours of every vertex are linked
+//   first, and the remaining edges are skipped for all vertices that are
+//   already in the most frequent component, found by random sampling
+//   (Afforest)
+// Vertices are 0-indexed
+// Constructor Arguments:
+//   G: a generic undirected graph structure with the fields ST and TO in
+//     compressed sparse row format, such as a StaticGraph, where the
+//     neighbours of v are TO[ST[v]] to TO[ST[v + 1] - 1], and each edge
+//     must appear in the adjacency lists of both endpoints
+//   V: the number of vertices in the graph
+//   edges: a vector of pairs representing the edges of the graph, where
+//     each edge only needs to appear once
+//   pool: a ThreadPool used to run the algorithm
+//   rounds: the number of neighbours of each vertex to link before sampling
+//   samples: the number of vertices to sample to find the most frequent
+//     component
+// Fields:
+//   par: a vector of the smallest vertex in the component of each vertex
+//   id: a vector of the index of the component each vertex is part of, where
+//     components are indexed in increasing order of their smallest vertex
+//   components: a vector of vectors containing the vertices in each
+//     component in increasing order
+// In practice, has a small constant, and skips most of the edges of graphs
+//   with a single large component
+// Time Complexity:
+//   constructor: O((V + E) log V) work in the worst case, divided among the
+//     threads in the pool, and close to O(V + E) in practice
+// Memory Complexity: O(V)
+// Tested:
+//   Stress Tested
+struct ParallelCC {
+  int V; vector<int> par, id; vector<vector<int>> components;
+  using UF = ConcurrentUnionFind<false>;
+  static void compress(UF &uf, ThreadPool &pool) {
+    pool.parallelFor(uf.par.size(), [&] (int, long long lo, long long hi) {
+      for (int v = lo; v < hi; v++)
+        __atomic_store_n(&uf.par[v], uf.find(v), __ATOMIC_RELAXED);
+    });
+  }
+  int mostFrequent(const vector<int> &p, int samples) {
+    mt19937_64 rng(0); unordered_map<int, int> cnt; int c = -1;
+    for (int i = 0; i < samples && V > 0; i++) {
+      int r = p[rng() % V], k = ++cnt[r]; if (c == -1 || k > cnt[c]) c = r;
+    }
+    return c;
+  }
+  void assign() {
+    for (int v = 0; v < V; v++) {
+      if (par[v] != v) id[v] = id[par[v]];
+      else { id[v] = components.size(); components.emplace_back(); }
+      components[id[v]].push_back(v);
+    }
+  }
+  template <class Graph>
+  ParallelCC(const Graph &G, ThreadPool &pool, int rounds = 2,
+             int samples = 1024)
+      : V(G.size()), id(V) {
+    UF uf(V, -1); for (int r = 0; r < rounds; r++) {
+      pool.parallelFor(V, [&] (int, long long lo, long long hi) {
+        for (int v = lo; v < hi; v++)
+          if (G.ST[v] + r < G.ST[v + 1]) uf.join(v, G.TO[G.ST[v] + r]);
+      }, 1 << 12);
+      compress(uf, pool);
+    }
+    int c = mostFrequent(uf.par, samples);
+    pool.parallelFor(V, [&] (int, long long lo, long long hi) {
+      for (int v = lo; v < hi; v++) if (uf.load(uf.par[v]) != c)
+        for (int e = G.ST[v] + rounds; e < G.ST[v + 1]; e++)
+          uf.join(v, G.TO[e]);
+    }, 1 << 12);
+    compress(uf, pool); par = move(uf.par); assign();
+  }
+  ParallelCC(int V, const vector<pair<int, int>> &edges, ThreadPool &pool)
+      : V(V), id(V) {
+    UF uf(V, -1);
+    pool.parallelFor(edges.size(), [&] (int, long long lo, long long hi) {
+      for (long long i = lo; i < hi; i++)
+        uf.join(edges[i].first, edges[i].second);
+    }, 1 << 14);
+    compress(uf, pool); par = move(uf.par); assign();
+  }
+};
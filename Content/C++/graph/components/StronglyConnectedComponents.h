@@ -3,7 +3,8 @@
 using namespace std;
 
 // Computes the strongly connected components of a directed graph using
-//   Tarjan's algorithm
+//   Tarjan's algorithm with an explicit stack, so that the depth of the
+//   graph is not limited by the size of the call stack
 // Vertices are 0-indexed
 // Constructor Arguments:
 //   G: a generic directed graph data structure
@@ -30,20 +31,30 @@ using namespace std;
 //   https://ecna18.kattis.com/problems/watchyourstep
 struct SCC {
   int V, ind, top; vector<int> id, low, stk; vector<vector<int>> components;
-  template <class Digraph> void dfs(const Digraph &G, int v) {
-    id[v] = -1; int mn = low[stk[top++] = v] = ind++; for (int w : G[v]) {
-      if (id[w] == -2) dfs(G, w);
-      mn = min(mn, low[w]);
-    }
-    if (mn < low[v]) { low[v] = mn; return; }
-    int w; components.emplace_back(); do {
-      id[w = stk[--top]] = components.size() - 1; low[w] = INT_MAX;
-      components.back().push_back(w);
-    } while (w != v);
+  template <class Digraph> void dfs(const Digraph &G) {
+    using It = typename decay<decltype(G[0].begin())>::type;
+    struct Frame { int v, mn; It it, en; }; vector<Frame> call;
+    auto push = [&] (int v) {
+      id[v] = -1; low[stk[top++] = v] = ind++;
+      call.push_back(Frame{v, low[v], G[v].begin(), G[v].end()});
+    };
+    for (int s = 0; s < V; s++) if (id[s] == -2)
+      for (push(s); !call.empty();) {
+        Frame &f = call.back(); if (f.it != f.en) {
+          int w = *f.it; if (id[w] == -2) { push(w); continue; }
+          f.mn = min(f.mn, low[w]); ++f.it; continue;
+        }
+        int v = f.v, mn = f.mn; call.pop_back();
+        if (mn < low[v]) { low[v] = mn; continue; }
+        int w; components.emplace_back(); do {
+          id[w = stk[--top]] = components.size() - 1; low[w] = INT_MAX;
+          components.back().push_back(w);
+        } while (w != v);
+      }
   }
   template <class Digraph> SCC(const Digraph &G)
       : V(G.size()), ind(0), top(0), id(V, -2), low(V), stk(V) {
-    for (int v = 0; v < V; v++) if (id[v] == -2) dfs(G, v);
+    dfs(G);
   }
   template <class Digraph>
   SCC(const Digraph &G, vector<pair<int, int>> &condensationEdges) : SCC(G) {
@@ -0,0 +1,79 @@
+#pragma once
+#include <bits/stdc++.h>
+#include "../../datastructures/unionfind/UnionFind.h"
+using namespace std;
+
+// Answers a batch of lowest common ancestor queries in a forest offline with
+//   Tarjan's algorithm, using a union find data structure and a depth first
+//   search computed using an explicit stack, where the queries of each
+//   vertex are stored contiguously
+// Vertices are 0-indexed
+// Constructor Arguments:
+//   G: a generic forest data structure (weighted or unweighted)
+//     with the [] operator (const) defined to iterate over the adjacency list
+//     (which is a list of ints for an unweighted forest, or a list of
+//     pair<int, T> for a weighted forest with weights of type T), as well as a
+//     member function size() (const) that returns the number of vertices
+//     in the forest
+//   queries: a vector of pairs of vertices (v, w)
+//   rt: a single root vertex
+//   roots: a vector of root vertices
+// Fields:
+//   root: vector of roots for the forest each vertex is in
+//   ans: the lowest common ancestor of each query, or -1 if the two vertices
+//     are not connected
+// In practice, has a moderate constant, and is slower than the batched lca
+//   function of the LCA struct, especially when the forest does not fit in
+//   cache, but uses less memory than the LCA struct
+// Time Complexity:
+//   constructor: O((V + Q) alpha V) for Q queries
+// Memory Complexity: O(V + Q)
+// Tested:
+//   Stress Tested
+struct OfflineLCA {
+  vector<int> root, ans;
+  static int getTo(int e) { return e; }
+  template <class T> static int getTo(const pair<int, T> &e) {
+    return e.first;
+  }
+  template <class Forest>
+  OfflineLCA(const Forest &G, const vector<pair<int, int>> &queries,
+             const vector<int> &roots = vector<int>())
+      : root(G.size(), -1), ans(queries.size(), -1) {
+    int V = G.size(), Q = queries.size();
+    vector<int> st(V + 1, 0), adj(Q * 2), anc(V); vector<bool> done(V, false);
+    for (auto &&q : queries) { st[q.first]++; st[q.second]++; }
+    partial_sum(st.begin(), st.end(), st.begin());
+    for (int i = 0; i < Q; i++) {
+      adj[--st[queries[i].first]] = i; adj[--st[queries[i].second]] = i;
+    }
+    UnionFind uf(V); using It = typename decay<decltype(G[0].begin())>::type;
+    struct Frame { int v, prev; It it, en; }; vector<Frame> call;
+    auto dfs = [&] (int r) {
+      auto push = [&] (int v, int prev) {
+        root[v] = r; anc[v] = v;
+        call.push_back(Frame{v, prev, G[v].begin(), G[v].end()});
+      };
+      for (push(r, -1); !call.empty();) {
+        Frame &f = call.back(); if (f.it != f.en) {
+          int w = getTo(*f.it); ++f.it;
+          if (w != f.prev) push(w, f.v);
+          continue;
+        }
+        int v = f.v; done[v] = true; for (int j = st[v]; j < st[v + 1]; j++) {
+          int i = adj[j], w = queries[i].first ^ queries[i].second ^ v;
+          if (done[w] && root[w] == r) ans[i] = anc[uf.find(w)];
+        }
+        call.pop_back(); if (!call.empty()) {
+          int p = call.back().v; uf.join(p, v); anc[uf.find(p)] = p;
+        }
+      }
+    };
+    if (roots.empty()) {
+      for (int v = 0; v < V; v++) if (root[v] == -1) dfs(v);
+    } else for (int rt : roots) dfs(rt);
+  }
+  template <class Forest>
+  OfflineLCA(const Forest &G, const vector<pair<int, int>> &queries, int rt)
+      : OfflineLCA(G, queries, vector<int>(1, rt)) {}
+};
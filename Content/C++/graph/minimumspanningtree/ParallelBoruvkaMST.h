@@ -0,0 +1,128 @@
+#pragma once
+#include <bits/stdc++.h>
+#include "../../utils/ThreadPool.h"
+using namespace std;
+
+// Computes the minimum spanning tree (or forest) using a parallel version of
+//   Boruvka's algorithm
+// In each round, the cheapest edge of each component is found with a compare
+//   and swap min-reduction over the edges, the components are merged along
+//   those edges with pointer jumping, and the edge list is contracted by
+//   relabelling the endpoints, removing self loops, grouping the edges by
+//   their smaller endpoint with a counting sort, and keeping only the
+//   cheapest edge between each pair of components
+// Ties between equal weights are broken by the index of the edge, so the
+//   mst has the same edges as BoruvkaMST
+// Vertices are 0-indexed
+// Constructor Arguments:
+//   V: number of vertices in the graph
+//   edges: a vector of the edges in the graph
+//   pool: a ThreadPool used to run the algorithm
+// Fields:
+//   mstWeight: the weight of the mst
+//   mstEdges: a vector of tuples of the edges in the mst
+// In practice, has a moderate constant, faster than BoruvkaMST on sparse
+//   graphs
+// Time Complexity:
+//   constructor: O((V + E) log V) work, divided among the threads in the
+//     pool, and the number of edges usually decreases quickly after each
+//     round
+// Memory Complexity: O(TV + E) for T threads
+// Tested:
+//   Stress Tested
+template <class T> struct ParallelBoruvkaMST {
+  using Edge = tuple<int, int, T>; struct CEdge { T weight; int v, w, i; };
+  T mstWeight; vector<Edge> mstEdges; vector<CEdge> cur, nxt;
+  vector<int> best, par, tmp, lbl;
+  static bool better(const CEdge &a, const CEdge &b) {
+    if (a.weight < b.weight) return true;
+    return !(b.weight < a.weight) && a.i < b.i;
+  }
+  void relax(int c, int e) {
+    for (int b = __atomic_load_n(&best[c], __ATOMIC_RELAXED);
+         b == -1 || better(cur[e], cur[b]);
+         b = __atomic_load_n(&best[c], __ATOMIC_RELAXED))
+      if (__sync_bool_compare_and_swap(&best[c], b, e)) return;
+  }
+  ParallelBoruvkaMST(int V, const vector<Edge> &edges, ThreadPool &pool)
+      : mstWeight(), cur(edges.size()), lbl(V) {
+    int P = pool.size(); vector<vector<int>> added(P);
+    vector<vector<int>> mark(P, vector<int>(V, -1));
+    vector<int> st(V + 1), off(V + 1, 0), pos(V);
+    vector<long long> cnt(P + 1); iota(lbl.begin(), lbl.end(), 0);
+    pool.parallelFor(edges.size(), [&] (int, long long lo, long long hi) {
+      for (long long e = lo; e < hi; e++) cur[e] = CEdge{
+          get<2>(edges[e]), get<0>(edges[e]), get<1>(edges[e]), int(e)};
+    });
+    for (int C = V; ; ) {
+      fill(cnt.begin(), cnt.end(), 0);
+      pool.parallelFor(cur.size(), [&] (int t, long long lo, long long hi) {
+        for (long long e = lo; e < hi; e++)
+          cnt[t + 1] += lbl[cur[e].v] != lbl[cur[e].w];
+      });
+      partial_sum(cnt.begin(), cnt.end(), cnt.begin()); nxt.resize(cnt[P]);
+      pool.parallelFor(cur.size(), [&] (int t, long long lo, long long hi) {
+        for (long long e = lo, j = cnt[t]; e < hi; e++) {
+          int v = lbl[cur[e].v], w = lbl[cur[e].w]; if (v == w) continue;
+          nxt[j++] = CEdge{cur[e].weight, min(v, w), max(v, w), cur[e].i};
+        }
+      });
+      fill(st.begin(), st.begin() + C + 1, 0);
+      for (auto &&e : nxt) st[e.v + 1]++;
+      partial_sum(st.begin(), st.begin() + C + 1, st.begin());
+      cur.resize(nxt.size()); copy(st.begin(), st.begin() + C, pos.begin());
+      for (auto &&e : nxt) cur[pos[e.v]++] = e;
+      pool.parallelFor(C, [&] (int t, long long lo, long long hi) {
+        vector<int> &m = mark[t]; for (int v = lo; v < hi; v++) {
+          int k = st[v]; for (int e = st[v]; e < st[v + 1]; e++) {
+            int &j = m[cur[e].w];
+            if (j == -1) cur[j = k++] = cur[e];
+            else if (better(cur[e], cur[j])) cur[j] = cur[e];
+          }
+          for (int e = st[v]; e < k; e++) m[cur[e].w] = -1;
+          off[v + 1] = k - st[v];
+        }
+      }, 1 << 10);
+      partial_sum(off.begin(), off.begin() + C + 1, off.begin());
+      nxt.resize(off[C]);
+      pool.parallelFor(C, [&] (int, long long lo, long long hi) {
+        for (int v = lo; v < hi; v++) copy(cur.begin() + st[v],
+            cur.begin() + st[v] + off[v + 1] - off[v], nxt.begin() + off[v]);
+      }, 1 << 10);
+      cur.swap(nxt);
+      if (cur.empty()) break;
+      best.assign(C, -1); par.resize(C); tmp.resize(C);
+      pool.parallelFor(cur.size(), [&] (int, long long lo, long long hi) {
+        for (long long e = lo; e < hi; e++) {
+          relax(cur[e].v, e); relax(cur[e].w, e);
+        }
+      }, 1 << 14);
+      pool.parallelFor(C, [&] (int t, long long lo, long long hi) {
+        for (int c = lo; c < hi; c++) {
+          int b = best[c]; par[c] = c; if (b == -1) continue;
+          int d = cur[b].v ^ cur[b].w ^ c;
+          if (best[d] != b || d < c) {
+            par[c] = d; added[t].push_back(cur[b].i);
+          }
+        }
+      });
+      for (atomic<bool> changed(true); changed.load();) {
+        changed = false;
+        pool.parallelFor(C, [&] (int, long long lo, long long hi) {
+          bool ch = false; for (int c = lo; c < hi; c++)
+            ch |= (tmp[c] = par[par[c]]) != par[c];
+          if (ch) changed = true;
+        });
+        par.swap(tmp);
+      }
+      int K = 0; for (int c = 0; c < C; c++) if (par[c] == c) tmp[c] = K++;
+      pool.parallelFor(C, [&] (int, long long lo, long long hi) {
+        for (int c = lo; c < hi; c++) lbl[c] = tmp[par[c]];
+      });
+      C = K;
+    }
+    for (auto &&a : added) for (int e : a) {
+      mstEdges.push_back(edges[e]); mstWeight += get<2>(edges[e]);
+    }
+  }
+};
@@ -4,6 +4,7 @@ using namespace std;
 
 // Finds the centroid of each component of a tree, and splits the component at that vertex
 // Can be used to create a centroid tree, which has depth O(log V)
+// The component sizes are computed iteratively, so the depth of the tree is not limited by the size of the call stack
 // Time Complexity:
 //    getCentroid: O(ComponentSize)
 //    bfs: O(V log V)
@@ -11,13 +12,21 @@ using namespace std;
 template <const int MAXV> struct CentroidDecomposition {
     vector<int> adj[MAXV]; bool exclude[MAXV]; int size[MAXV], par[MAXV]; pair<int, int> q[MAXV];
     void addEdge(int v, int w) { adj[v].push_back(w); adj[w].push_back(v); }
+    int ord[MAXV], from[MAXV];
     int getSize(int v, int prev) {
-        size[v] = 1;
-        for (int w : adj[v]) if (w != prev && !exclude[w]) size[v] += getSize(w, v);
+        int front = 0, back = 0; from[v] = prev; ord[back++] = v;
+        while (front < back) {
+            int u = ord[front++]; size[u] = 1;
+            for (int w : adj[u]) if (w != from[u] && !exclude[w]) { from[w] = u; ord[back++] = w; }
+        }
+        for (int i = back - 1; i > 0; i--) size[from[ord[i]]] += size[ord[i]];
         return size[v];
     }
     int getCentroid(int v, int prev, int treeSize) {
-        for (int w : adj[v]) if (w != prev && !exclude[w] && size[w] > treeSize / 2) return getCentroid(w, v, treeSize);
+        for (bool moved = true; moved;) {
+            moved = false;
+            for (int w : adj[v]) if (w != prev && !exclude[w] && size[w] > treeSize / 2) { prev = v; v = w; moved = true; break; }
+        }
         return v;
     }
     void init(int V = MAXV) { fill(exclude, exclude + V, false); fill(par, par + V, -1); for (int i = 0; i < V; i++) adj[i].clear(); }
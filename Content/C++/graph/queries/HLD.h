@@ -3,6 +3,7 @@
 using namespace std;
 
 // Decomposes a tree into chains, such that a path from any vertex to the root will cover at most log V chains
+// The tree is traversed iteratively, so its depth is not limited by the size of the call stack
 // Time Complexity:
 //   run: O(V)
 //   lca: O(log V)
@@ -13,17 +14,24 @@ template <const int MAXV, const bool ONE_INDEXED, const bool VALUES_ON_EDGES> st
     using Data = int; using Lazy = int; const Data qdef = 0;
     int dep[MAXV], par[MAXV], size[MAXV], head[MAXV], pre[MAXV], post[MAXV], vert[MAXV], curInd; vector<int> adj[MAXV];
     void addEdge(int a, int b) { adj[a].push_back(b); adj[b].push_back(a); }
-    void dfs(int v, int prev, int d) {
-        dep[v] = d; par[v] = prev; size[v] = 1; head[v] = -1;
-        for (int w : adj[v]) if (w != prev) { dfs(w, v, d + 1); size[v] += size[w]; }
+    int stk[MAXV];
+    void dfs(int root) {
+        int front = 0, back = 0; dep[root] = 0; par[root] = -1; vert[back++] = root;
+        while (front < back) {
+            int v = vert[front++]; size[v] = 1; head[v] = -1;
+            for (int w : adj[v]) if (w != par[v]) { dep[w] = dep[v] + 1; par[w] = v; vert[back++] = w; }
+        }
+        for (int i = back - 1; i > 0; i--) size[par[vert[i]]] += size[vert[i]];
     }
-    void hld(int v, int prev) {
-        if (head[v] == -1) head[v] = v;
-        vert[pre[v] = ++curInd] = v; int maxInd = -1;
-        for (int w : adj[v]) if (w != prev && (maxInd == -1 || size[maxInd] < size[w])) maxInd = w;
-        if (maxInd != -1) { head[maxInd] = head[v]; hld(maxInd, v); }
-        for (int w : adj[v]) if (w != prev && w != maxInd) hld(w, v);
-        post[v] = curInd;
+    void hld(int root) {
+        int top = 0; stk[top++] = root;
+        while (top > 0) {
+            int v = stk[--top]; if (head[v] == -1) head[v] = v;
+            vert[pre[v] = ++curInd] = v; post[v] = pre[v] + size[v] - 1; int maxInd = -1;
+            for (int w : adj[v]) if (w != par[v] && (maxInd == -1 || size[maxInd] < size[w])) maxInd = w;
+            for (int i = int(adj[v].size()) - 1; i >= 0; i--) if (adj[v][i] != par[v] && adj[v][i] != maxInd) stk[top++] = adj[v][i];
+            if (maxInd != -1) { head[maxInd] = head[v]; stk[top++] = maxInd; }
+        }
     }
     Data merge(const Data &l, const Data &r); // to be implemented
     void update(int l, int r, bool up, const Lazy &val); // to be implemented
@@ -74,5 +82,5 @@ template <const int MAXV, const bool ONE_INDEXED, const bool VALUES_ON_EDGES> st
         else return kthUp(w, LCA, dep[v] + dep[w] - 2 * dep[LCA] - k);
     }
     void clear(int V = MAXV) { for (int i = 0; i < V; i++) adj[i].clear(); }
-    void run(int V, int root = 0) { curInd = int(ONE_INDEXED) - 1; dfs(root, -1, 0); hld(root, -1); }
+    void run(int, int root = 0) { curInd = int(ONE_INDEXED) - 1; dfs(root); hld(root); }
 };
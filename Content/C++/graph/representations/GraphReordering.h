@@ -0,0 +1,184 @@
+#pragma once
+#include <bits/stdc++.h>
+#include "StaticGraph.h"
+using namespace std;
+
+// Functions to compute vertex orders that improve the memory locality of
+//   graph traversals, with each function returning a vector ord where ord[i]
+//   is the vertex that is given the new label i
+// Vertices are 0-indexed
+// Function Arguments:
+//   G: a generic graph data structure (weighted or unweighted)
+//     with the [] operator (const) defined to iterate over the adjacency list
+//     (which is a list of ints for an unweighted graph, or a list of
+//     pair<int, T> for a weighted graph with weights of type T), as well as a
+//     member function size() (const) that returns the number of vertices
+//     in the graph
+// Functions:
+//   degreeOrder(G): orders the vertices by non increasing degree, which
+//     places the high degree vertices that are accessed most often together
+//   bfsOrder(G): orders the vertices in breadth first search order, starting
+//     from the lowest unvisited vertex for each component
+//   reverseCuthillMcKeeOrder(G): orders the vertices in the reverse
+//     Cuthill-McKee order (see CuthillMcKee), which reduces the bandwidth of
+//     the adjacency matrix; ties in degree are broken by vertex index, as in
+//     CuthillMcKee
+//   bisectionOrder(G, leafSize): recursively splits each set of vertices into
+//     two halves in breadth first search order from a pseudo peripheral
+//     vertex, until each set has at most leafSize vertices, which keeps
+//     vertices that are close in the graph close in the order at every scale
+// In practice, degreeOrder, bfsOrder, and reverseCuthillMcKeeOrder have a
+//   small constant, and bisectionOrder has a moderate constant
+// Time Complexity:
+//   degreeOrder: O(V log V + E)
+//   bfsOrder: O(V + E)
+//   reverseCuthillMcKeeOrder: O(V + E log V)
+//   bisectionOrder: O((V + E) log (V / leafSize))
+// Memory Complexity: O(V)
+// Tested:
+//   Stress Tested
+int reorderTo(int e) { return e; }
+template <class T> int reorderTo(const pair<int, T> &e) { return e.first; }
+
+template <class Graph> vector<int> vertexDegrees(const Graph &G) {
+  vector<int> deg(G.size(), 0); for (int v = 0; v < int(G.size()); v++)
+    for (auto &&e : G[v]) { deg[v]++; (void) e; }
+  return deg;
+}
+
+template <class Graph> vector<int> degreeOrder(const Graph &G) {
+  vector<int> ord(G.size()), deg = vertexDegrees(G);
+  iota(ord.begin(), ord.end(), 0);
+  stable_sort(ord.begin(), ord.end(), [&] (int v, int w) {
+    return deg[v] > deg[w];
+  });
+  return ord;
+}
+
+template <class Graph> vector<int> bfsOrder(const Graph &G) {
+  int V = G.size(); vector<int> ord; ord.reserve(V);
+  vector<bool> vis(V, false);
+  for (int s = 0; s < V; s++) if (!vis[s]) {
+    vis[s] = true; ord.push_back(s);
+    for (int front = int(ord.size()) - 1; front < int(ord.size()); front++)
+      for (auto &&e : G[ord[front]]) {
+        int w = reorderTo(e); if (!vis[w]) { vis[w] = true; ord.push_back(w); }
+      }
+  }
+  return ord;
+}
+
+template <class Graph> vector<int> reverseCuthillMcKeeOrder(const Graph &G) {
+  int V = G.size(); vector<int> ord, starts(V), deg = vertexDegrees(G), adj;
+  ord.reserve(V); vector<bool> vis(V, false);
+  auto cmp = [&] (int v, int w) {
+    return deg[v] == deg[w] ? v < w : deg[v] < deg[w];
+  };
+  iota(starts.begin(), starts.end(), 0);
+  sort(starts.begin(), starts.end(), cmp); for (int s : starts) {
+    if (vis[s]) continue;
+    vis[s] = true; ord.push_back(s);
+    for (int front = int(ord.size()) - 1; front < int(ord.size()); front++) {
+      adj.clear(); for (auto &&e : G[ord[front]]) {
+        int w = reorderTo(e); if (!vis[w]) { vis[w] = true; adj.push_back(w); }
+      }
+      sort(adj.begin(), adj.end(), cmp);
+      ord.insert(ord.end(), adj.begin(), adj.end());
+    }
+  }
+  reverse(ord.begin(), ord.end()); return ord;
+}
+
+template <class Graph>
+vector<int> bisectionOrder(const Graph &G, int leafSize = 64) {
+  int V = G.size(), groups = 1; vector<int> ord(V), grp(V, 0), vis(V, -1);
+  vector<int> q; q.reserve(V); int stamp = 0; iota(ord.begin(), ord.end(), 0);
+  auto bfs = [&] (int lo, int hi, int s) {
+    int g = grp[s]; q.clear(); stamp++; for (int i = lo - 1; i < hi; i++) {
+      int r = i < lo ? s : ord[i]; if (vis[r] == stamp) continue;
+      vis[r] = stamp; q.push_back(r);
+      for (int front = int(q.size()) - 1; front < int(q.size()); front++)
+        for (auto &&e : G[q[front]]) {
+          int w = reorderTo(e); if (grp[w] != g || vis[w] == stamp) continue;
+          vis[w] = stamp; q.push_back(w);
+        }
+    }
+    copy(q.begin(), q.end(), ord.begin() + lo);
+  };
+  vector<pair<int, int>> stk{make_pair(0, V)}; while (!stk.empty()) {
+    int lo = stk.back().first, hi = stk.back().second; stk.pop_back();
+    if (hi - lo <= 1) continue;
+    bfs(lo, hi, ord[lo]); bfs(lo, hi, ord[hi - 1]);
+    if (hi - lo <= leafSize) continue;
+    int mid = lo + (hi - lo) / 2;
+    for (int i = mid; i < hi; i++) grp[ord[i]] = groups;
+    groups++; stk.emplace_back(mid, hi); stk.emplace_back(lo, mid);
+  }
+  return ord;
+}
+
+// Relabels the vertices of a StaticGraph or StaticWeightedGraph according
+//   to a vertex order, and maps the results of algorithms run on the
+//   relabeled graph back to the original labels
+// Vertices are 0-indexed
+// Constructor Arguments:
+//   ord: a permutation of the vertices where ord[i] is the vertex that is
+//     given the new label i, such as one returned by the functions above
+// Fields:
+//   ord: the original vertex with each new label
+//   ind: the new label of each original vertex
+// Functions:
+//   apply(G): returns a copy of the StaticGraph or StaticWeightedGraph G with
+//     each vertex v relabeled to ind[v]
+//   toNew(vs): returns the new labels of a list of original vertices,
+//     such as a list of sources
+//   fromNew(A): returns a vector B of values indexed by vertex where
+//     B[v] = A[ind[v]], such as distances or component ids computed on
+//     the relabeled graph
+//   fromNewVertices(A): same as fromNew, except that each value is also a
+//     vertex (or -1) that is mapped back to its original label,
+//     such as parent vertices computed on the relabeled graph
+// In practice, apply has a moderate constant, and the rest have a small
+//   constant
+// Time Complexity:
+//   constructor, toNew, fromNew, fromNewVertices: O(V)
+//   apply: O(V + E)
+// Memory Complexity: O(V)
+// Tested:
+//   Stress Tested
+struct GraphReordering {
+  vector<int> ord, ind;
+  GraphReordering(const vector<int> &ord) : ord(ord), ind(ord.size()) {
+    for (int i = 0; i < int(ord.size()); i++) ind[ord[i]] = i;
+  }
+  StaticGraph apply(const StaticGraph &G) const {
+    StaticGraph H(G.size()); H.build([&] (StaticGraph::EdgeSink f) {
+      for (int i = 0; i < G.size(); i++) for (int w : G[ord[i]]) f(i, ind[w]);
+    });
+    return H;
+  }
+  template <class T>
+  StaticWeightedGraph<T> apply(const StaticWeightedGraph<T> &G) const {
+    StaticWeightedGraph<T> H(G.size());
+    H.build([&] (typename StaticWeightedGraph<T>::EdgeSink f) {
+      for (int i = 0; i < G.size(); i++)
+        for (auto &&e : G[ord[i]]) f(i, ind[e.first], e.second);
+    });
+    return H;
+  }
+  vector<int> toNew(const vector<int> &vs) const {
+    vector<int> ret; ret.reserve(vs.size());
+    for (int v : vs) ret.push_back(ind[v]);
+    return ret;
+  }
+  template <class T> vector<T> fromNew(const vector<T> &A) const {
+    vector<T> B; B.reserve(A.size());
+    for (int v = 0; v < int(A.size()); v++) B.push_back(A[ind[v]]);
+    return B;
+  }
+  vector<int> fromNewVertices(const vector<int> &A) const {
+    vector<int> B = fromNew(A);
+    for (auto &&b : B) if (b != -1) b = ord[b];
+    return B;
+  }
+};
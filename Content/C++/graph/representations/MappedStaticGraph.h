@@ -0,0 +1,199 @@
+#pragma once
+#include <bits/stdc++.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "StaticGraph.h"
+using namespace std;
+
+// Versioned binary file format for graphs in compressed sparse row form,
+//   which can be memory mapped without any copies or parsing
+// All values are stored in the native byte order of the machine
+// Layout:
+//   header: CSRFileHeader
+//   ST: V + 1 values of type int
+//   TO: E values of type int
+//   zero padding to the next multiple of 8 bytes
+//   WEIGHT: E values of the weight type, only if weightSize is not 0
+struct CSRFileHeader {
+  static constexpr uint32_t VERSION = 1;
+  char magic[8]; uint32_t version, weightSize; uint64_t V, E;
+  CSRFileHeader(uint64_t V = 0, uint64_t E = 0, uint32_t weightSize = 0)
+      : version(VERSION), weightSize(weightSize), V(V), E(E) {
+    memcpy(magic, "CSRGRAPH", 8);
+  }
+  bool valid() const {
+    return memcmp(magic, "CSRGRAPH", 8) == 0 && version == VERSION;
+  }
+  uint64_t offsetST() const { return sizeof(CSRFileHeader); }
+  uint64_t offsetTO() const { return offsetST() + sizeof(int) * (V + 1); }
+  uint64_t offsetWeight() const {
+    return (offsetTO() + sizeof(int) * E + 7) / 8 * 8;
+  }
+  uint64_t fileSize() const { return offsetWeight() + weightSize * E; }
+};
+
+// Writes the header followed by the arrays of a graph in the CSR file format
+inline void writeCSRFile(const CSRFileHeader &h, const int *ST, const int *TO,
+                         const void *WEIGHT, const string &filename) {
+  unique_ptr<FILE, int (*)(FILE *)> f(fopen(filename.c_str(), "wb"), fclose);
+  char pad[8] = {}; bool ok = bool(f);
+  ok = ok && fwrite(&h, sizeof(h), 1, f.get()) == 1;
+  ok = ok && fwrite(ST, sizeof(int), h.V + 1, f.get()) == h.V + 1;
+  ok = ok && fwrite(TO, sizeof(int), h.E, f.get()) == h.E;
+  uint64_t p = h.offsetWeight() - h.offsetTO() - sizeof(int) * h.E;
+  ok = ok && fwrite(pad, 1, p, f.get()) == p;
+  if (h.weightSize)
+    ok = ok && fwrite(WEIGHT, h.weightSize, h.E, f.get()) == h.E;
+  if (!ok || fflush(f.get()) != 0)
+    throw runtime_error("Failed to write CSR file " + filename);
+}
+
+// Writes a built graph to a file in the CSR file format
+// Function Arguments:
+//   G: a StaticGraph or StaticWeightedGraph that has been built
+//   filename: the name of the file to write to
+// Throws a runtime_error if the file could not be written
+// In practice, has a small constant, and is bound by the speed of the disk
+// Time Complexity: O(V + E)
+// Memory Complexity: O(1) additional memory
+// Tested:
+//   Stress Tested
+inline void writeCSRFile(const StaticGraph &G, const string &filename) {
+  writeCSRFile(CSRFileHeader(G.size(), G.ST.back()), G.ST.data(),
+               G.TO.data(), nullptr, filename);
+}
+template <class T>
+void writeCSRFile(const StaticWeightedGraph<T> &G, const string &filename) {
+  static_assert(is_trivially_copyable<T>::value,
+                "T must be trivially copyable");
+  writeCSRFile(CSRFileHeader(G.size(), G.ST.back(), sizeof(T)), G.ST.data(),
+               G.TO.data(), G.WEIGHT.data(), filename);
+}
+
+// Read only memory mapping of a file in the CSR file format
+// Constructor Arguments:
+//   filename: the name of the file to map
+//   weightSize: the expected size of each weight in bytes, or 0 if the
+//     graph is unweighted
+// Throws a runtime_error if the file could not be opened or mapped, or if
+//   the header does not match the expected format
+// Fields:
+//   h: the header of the file
+//   data: a pointer to the start of the mapping
+// Time Complexity:
+//   constructor: O(1), with pages being loaded as they are accessed
+// Memory Complexity: O(1), not including the page cache
+struct MappedCSRFile {
+  CSRFileHeader h; char *data; size_t len;
+  MappedCSRFile(const string &filename, uint32_t weightSize)
+      : data(nullptr), len(0) {
+    int fd = open(filename.c_str(), O_RDONLY); struct stat st;
+    if (fd == -1) throw runtime_error("Failed to open CSR file " + filename);
+    if (fstat(fd, &st) == -1 || size_t(st.st_size) < sizeof(h)) {
+      close(fd); throw runtime_error("Invalid CSR file " + filename);
+    }
+    void *p = mmap(nullptr, len = st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) throw runtime_error("Failed to map " + filename);
+    memcpy(&h, data = static_cast<char *>(p), sizeof(h));
+    if (!h.valid() || h.weightSize != weightSize || h.fileSize() > len
+        || h.V >= uint64_t(INT_MAX) || h.E > uint64_t(INT_MAX)) {
+      munmap(data, len); throw runtime_error("Invalid CSR file " + filename);
+    }
+  }
+  MappedCSRFile(const MappedCSRFile &) = delete;
+  MappedCSRFile &operator = (const MappedCSRFile &) = delete;
+  ~MappedCSRFile() { munmap(data, len); }
+  template <class U> const U *at(uint64_t offset) const {
+    return reinterpret_cast<const U *>(data + offset);
+  }
+};
+
+// Static Graph loaded from a memory mapped file in the CSR file format
+// The arrays ST and TO are read directly from the mapping with no copies,
+//   and have the same meaning as in StaticGraph
+// Vertices are 0-indexed
+// Constructor Arguments:
+//   filename: the name of a file written by writeCSRFile from a StaticGraph
+// Functions:
+//   operator [v]: returns a struct with the begin() and end() defined to
+//     iterate over the vertices adjacent to vertex v
+//   size(): returns the number of vertices in the graph
+// In practice, constructor has a very small constant, and operator [] has a
+//   very small constant once the pages of the file are in memory
+// Time Complexity:
+//   constructor, operator [], size: O(1)
+// Memory Complexity: O(1), not including the page cache
+// Tested:
+//   Stress Tested
+struct MappedStaticGraph {
+  MappedCSRFile file; const int *ST, *TO;
+  MappedStaticGraph(const string &filename)
+      : file(filename, 0), ST(file.at<int>(file.h.offsetST())),
+        TO(file.at<int>(file.h.offsetTO())) {}
+  struct Iterator {
+    const int *p; Iterator(const int *p) : p(p) {}
+    Iterator &operator ++ () { p++; return *this; }
+    int operator * () const { return *p; }
+    bool operator != (const Iterator &it) const { return p != it.p; }
+  };
+  struct Adj {
+    const MappedStaticGraph &G; int v;
+    Adj(const MappedStaticGraph &G, int v) : G(G), v(v) {}
+    const Iterator begin() const { return Iterator(G.TO + G.ST[v]); }
+    const Iterator end() const { return Iterator(G.TO + G.ST[v + 1]); }
+  };
+  const Adj operator [] (int v) const { return Adj(*this, v); }
+  int size() const { return int(file.h.V); }
+};
+
+// Static Weighted Graph loaded from a memory mapped file in the
+//   CSR file format
+// The arrays ST, TO, and WEIGHT are read directly from the mapping with no
+//   copies, and have the same meaning as in StaticWeightedGraph
+// Vertices are 0-indexed
+// Template Arguments:
+//   T: the type of the weight of the edges in the weighted graph, which must
+//     be the same type used to write the file
+// Constructor Arguments:
+//   filename: the name of a file written by writeCSRFile from a
+//     StaticWeightedGraph
+// Functions:
+//   operator [v]: returns a struct with the begin() and end() defined to
+//     iterate over the edges incident to vertex v
+//   size(): returns the number of vertices in the graph
+// In practice, constructor has a very small constant, and operator [] has a
+//   very small constant once the pages of the file are in memory
+// Time Complexity:
+//   constructor, operator [], size: O(1)
+// Memory Complexity: O(1), not including the page cache
+// Tested:
+//   Stress Tested
+template <class T> struct MappedStaticWeightedGraph {
+  static_assert(is_trivially_copyable<T>::value,
+                "T must be trivially copyable");
+  MappedCSRFile file; const int *ST, *TO; const T *WEIGHT;
+  MappedStaticWeightedGraph(const string &filename)
+      : file(filename, sizeof(T)), ST(file.at<int>(file.h.offsetST())),
+        TO(file.at<int>(file.h.offsetTO())),
+        WEIGHT(file.at<T>(file.h.offsetWeight())) {}
+  struct Iterator {
+    const MappedStaticWeightedGraph &G; int i;
+    Iterator(const MappedStaticWeightedGraph &G, int i) : G(G), i(i) {}
+    Iterator &operator ++ () { i++; return *this; }
+    pair<int, T> operator * () const {
+      return make_pair(G.TO[i], G.WEIGHT[i]);
+    }
+    bool operator != (const Iterator &it) const { return i != it.i; }
+  };
+  struct Adj {
+    const MappedStaticWeightedGraph &G; int v;
+    Adj(const MappedStaticWeightedGraph &G, int v) : G(G), v(v) {}
+    const Iterator begin() const { return Iterator(G, G.ST[v]); }
+    const Iterator end() const { return Iterator(G, G.ST[v + 1]); }
+  };
+  const Adj operator [] (int v) const { return Adj(*this, v); }
+  int size() const { return int(file.h.V); }
+};
@@ -1,5 +1,7 @@
 #pragma once
 #include <bits/stdc++.h>
+#include "../../utils/ParallelScan.h"
+#include "../../utils/ThreadPool.h"
 using namespace std;
 
 // Static Graph implemented with fixed size arrays
@@ -18,20 +20,43 @@ using namespace std;
 //   operator [v]: returns a struct with the begin() and end() defined to
 //     iterate over the vertices adjacent to vertex v
 //   size(): returns the number of vertices in the graph
-//   build(): builds a graph using the edges that have been added
+//   build(): builds a graph using the edges that have been added, and frees
+//     the memory used to store the added edges
+//   build(gen): builds a graph without storing the edges separately, where
+//     gen(f) is passed an EdgeSink f and must call f(from, to) for each
+//     directed edge from the vertex from to the vertex to, in the same order
+//     each time it is called; gen is called twice, once to count the degrees
+//     and once to place each edge, and addDiEdge and addBiEdge must not
+//     have been called
+//   build(deg, gen): same as build(gen), except that deg[v] is the number of
+//     edges from vertex v, and gen is only called once
+//   build(gen, pool): same as build(gen), except that gen(t, P, f) is called
+//     once on each thread t of the P threads in pool, and the edges are
+//     the edges produced by thread 0, followed by thread 1, and so on;
+//     each thread counts its degrees and places its edges in its own range
+//     of each adjacency list
+// The behaviour of build(gen), build(deg, gen) and build(gen, pool) is
+//   undefined if gen does not produce the same edges each time it is called,
+//   or if the edges do not match deg, since each edge is written without
+//   bounds checking into a position reserved by the degree counts
 // In practice, addBiEdge and addDiEdge have a small constant, build has a
 //   moderate constant, and operator [] has a very small constant
 // Graph construction is faster than adjacency lists, but slower than
 //   linked lists
 // Graph traveral is faster than adjacency lists and linked lists
 // Uses less memory than adjacency lists, but more memory than linked lists
+// build() has a peak memory of 3 ints per edge, while build(gen) and
+//   build(deg, gen) have a peak memory of 1 int per edge, and build(gen, pool)
+//   additionally uses P ints per vertex; all have 1 int per edge afterwards
 // Time Complexity:
 //   constructor: O(V)
 //   addDiEdge: O(1) amortized
 //   build: O(V + E)
+//   build with a pool: O(PV + E / P) with P threads
 //   operator [], size: O(1)
 // Memory Complexity: O(V + E)
 // Tested:
+//   Stress Tested
 //   https://judge.yosupo.jp/problem/lca
 struct StaticGraph {
   vector<int> ST, TO, A, B; StaticGraph(int V) : ST(V + 1, 0) {}
@@ -43,8 +68,48 @@ struct StaticGraph {
   }
   void addBiEdge(int v, int w) { addDiEdge(v, w); addDiEdge(w, v); }
   void build() {
-    partial_sum(ST.begin(), ST.end(), ST.begin()); TO = B;
+    partial_sum(ST.begin(), ST.end(), ST.begin()); TO.resize(A.size());
     for (int e = 0; e < int(A.size()); e++) TO[--ST[A[e]]] = B[e];
+    vector<int>().swap(A); vector<int>().swap(B);
+  }
+  struct EdgeSink {
+    int *cnt, *TO;
+    void operator () (int from, int to) const {
+      if (TO) TO[--cnt[from]] = to;
+      else cnt[from]++;
+    }
+  };
+  template <class Generator> void scatter(Generator gen) {
+    partial_sum(ST.begin(), ST.end(), ST.begin()); TO.resize(ST.back());
+    gen(EdgeSink{ST.data(), TO.data()});
+  }
+  template <class Generator> void build(Generator gen) {
+    gen(EdgeSink{ST.data(), nullptr}); scatter(gen);
+  }
+  template <class Generator>
+  void build(const vector<int> &deg, Generator gen) {
+    copy(deg.begin(), deg.end(), ST.begin()); scatter(gen);
+  }
+  template <class Generator> void build(Generator gen, ThreadPool &pool) {
+    int V = size(), P = pool.size(); vector<vector<int>> off(P);
+    pool.run([&] (int t) {
+      off[t].assign(V, 0); gen(t, P, EdgeSink{off[t].data(), nullptr});
+    });
+    pool.parallelFor(V, [&] (int, long long lo, long long hi) {
+      for (long long v = lo; v < hi; v++)
+        for (int t = 0; t < P; t++) ST[v] += off[t][v];
+    });
+    inclusiveScan(ST.begin(), ST.end(), ST.begin(), 0, plus<int>(), pool);
+    TO.resize(ST.back());
+    pool.parallelFor(V, [&] (int, long long lo, long long hi) {
+      for (long long v = lo; v < hi; v++) for (int t = 0; t < P; t++) {
+        int d = off[t][v]; off[t][v] = ST[v]; ST[v] -= d;
+      }
+    });
+    pool.run([&] (int t) {
+      gen(t, P, EdgeSink{off[t].data(), TO.data()});
+      vector<int>().swap(off[t]);
+    });
   }
   struct Iterator {
     const StaticGraph &G; int i;
@@ -82,20 +147,44 @@ struct StaticGraph {
 //   operator [v]: returns a struct with the begin() and end() defined to
 //     iterate over the edges incident to vertex v
 //   size(): returns the number of vertices in the graph
-//   build(): builds a graph using the edges that have been added
+//   build(): builds a graph using the edges that have been added, and frees
+//     the memory used to store the added edges
+//   build(gen): builds a graph without storing the edges separately, where
+//     gen(f) is passed an EdgeSink f and must call f(from, to, weight) for
+//     each directed edge from the vertex from to the vertex to with a weight
+//     of weight, in the same order each time it is called; gen is called
+//     twice, once to count the degrees and once to place each edge, and
+//     addDiEdge and addBiEdge must not have been called
+//   build(deg, gen): same as build(gen), except that deg[v] is the number of
+//     edges from vertex v, and gen is only called once
+//   build(gen, pool): same as build(gen), except that gen(t, P, f) is called
+//     once on each thread t of the P threads in pool, and the edges are
+//     the edges produced by thread 0, followed by thread 1, and so on;
+//     each thread counts its degrees and places its edges in its own range
+//     of each adjacency list
+// The behaviour of build(gen), build(deg, gen) and build(gen, pool) is
+//   undefined if gen does not produce the same edges each time it is called,
+//   or if the edges do not match deg, since each edge is written without
+//   bounds checking into a position reserved by the degree counts
 // In practice, addBiEdge and addDiEdge have a small constant, build has a
 //   moderate constant, and operator [] has a very small constant
 // Graph construction is faster than adjacency lists, but slower than
 //   linked lists
 // Graph traveral is faster than adjacency lists and linked lists
 // Uses less memory than adjacency lists, but more memory than linked lists
+// build() has a peak memory of 3 ints and 2 weights per edge, while
+//   build(gen) and build(deg, gen) have a peak memory of 1 int and 1 weight
+//   per edge, and build(gen, pool) additionally uses P ints per vertex;
+//   all have 1 int and 1 weight per edge afterwards
 // Time Complexity:
 //   constructor: O(V)
 //   addBiEdge, addDiEdge: O(1) amortized
 //   build: O(V + E)
+//   build with a pool: O(PV + E / P) with P threads
 //   operator [], size: O(1)
 // Memory Complexity: O(V + E)
 // Tested:
+//   Stress Tested
 //   https://dmoj.ca/problem/rte16s3
 template <class T> struct StaticWeightedGraph {
   vector<int> ST, TO, A, B; vector<T> C, WEIGHT;
@@ -110,10 +199,53 @@ template <class T> struct StaticWeightedGraph {
     addDiEdge(v, w, weight); addDiEdge(w, v, weight);
   }
   void build() {
-    partial_sum(ST.begin(), ST.end(), ST.begin()); TO = B; WEIGHT = C;
+    partial_sum(ST.begin(), ST.end(), ST.begin());
+    TO.resize(A.size()); WEIGHT.resize(A.size());
     for (int e = 0; e < int(A.size()); e++) {
       TO[--ST[A[e]]] = B[e]; WEIGHT[ST[A[e]]] = C[e];
     }
+    vector<int>().swap(A); vector<int>().swap(B); vector<T>().swap(C);
+  }
+  struct EdgeSink {
+    int *cnt, *TO; T *WEIGHT;
+    void operator () (int from, int to, T weight) const {
+      if (TO) { TO[--cnt[from]] = to; WEIGHT[cnt[from]] = weight; }
+      else cnt[from]++;
+    }
+  };
+  template <class Generator> void scatter(Generator gen) {
+    partial_sum(ST.begin(), ST.end(), ST.begin());
+    TO.resize(ST.back()); WEIGHT.resize(ST.back());
+    gen(EdgeSink{ST.data(), TO.data(), WEIGHT.data()});
+  }
+  template <class Generator> void build(Generator gen) {
+    gen(EdgeSink{ST.data(), nullptr, nullptr}); scatter(gen);
+  }
+  template <class Generator>
+  void build(const vector<int> &deg, Generator gen) {
+    copy(deg.begin(), deg.end(), ST.begin()); scatter(gen);
+  }
+  template <class Generator> void build(Generator gen, ThreadPool &pool) {
+    int V = size(), P = pool.size(); vector<vector<int>> off(P);
+    pool.run([&] (int t) {
+      off[t].assign(V, 0);
+      gen(t, P, EdgeSink{off[t].data(), nullptr, nullptr});
+    });
+    pool.parallelFor(V, [&] (int, long long lo, long long hi) {
+      for (long long v = lo; v < hi; v++)
+        for (int t = 0; t < P; t++) ST[v] += off[t][v];
+    });
+    inclusiveScan(ST.begin(), ST.end(), ST.begin(), 0, plus<int>(), pool);
+    TO.resize(ST.back()); WEIGHT.resize(ST.back());
+    pool.parallelFor(V, [&] (int, long long lo, long long hi) {
+      for (long long v = lo; v < hi; v++) for (int t = 0; t < P; t++) {
+        int d = off[t][v]; off[t][v] = ST[v]; ST[v] -= d;
+      }
+    });
+    pool.run([&] (int t) {
+      gen(t, P, EdgeSink{off[t].data(), TO.data(), WEIGHT.data()});
+      vector<int>().swap(off[t]);
+    });
   }
   struct Iterator {
     const StaticWeightedGraph &G; int i;
@@ -3,6 +3,7 @@
 using namespace std;
 
 // Computes Depth First Orders of a graph (pre order, post order, topological / reverse post order)
+//   iteratively
 // Time Complexity: O(V + E)
 // Memory Complexity: O(V + E)
 template <const int MAXV> struct DFSOrder {
@@ -11,10 +12,15 @@ template <const int MAXV> struct DFSOrder {
     void addEdge(int v, int w) { adj[v].push_back(w); }
     void addBiEdge(int v, int w) { addEdge(v, w); addEdge(w, v); }
     void clear(int V = MAXV) { for (int i = 0; i < V; i++) adj[i].clear(); }
-    void dfs(int v) {
-        preOrd[preInd[v] = curPre++] = v;
-        for (int w : adj[v]) if (preInd[w] == -1) dfs(w);
-        postOrd[postInd[v] = curPost++] = revPostOrd[revPostInd[v] = curRevPost--] = v;
+    pair<int, int> stk[MAXV];
+    void dfs(int r) {
+        int top = 0; preOrd[preInd[r] = curPre++] = r; stk[top++] = make_pair(r, 0);
+        while (top > 0) {
+            int v = stk[top - 1].first, &i = stk[top - 1].second;
+            if (i == int(adj[v].size())) { postOrd[postInd[v] = curPost++] = revPostOrd[revPostInd[v] = curRevPost--] = v; top--; continue; }
+            int w = adj[v][i++];
+            if (preInd[w] == -1) { preOrd[preInd[w] = curPre++] = w; stk[top++] = make_pair(w, 0); }
+        }
     }
     void run(int V, int s = 0) {
         fill(preInd, preInd + V, -1); curPre = curPost = 0; curRevPost = V - 1; dfs(s);
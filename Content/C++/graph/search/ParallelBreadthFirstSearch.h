@@ -0,0 +1,135 @@
+#pragma once
+#include <bits/stdc++.h>
+#include "../../utils/ThreadPool.h"
+using namespace std;
+
+// Level synchronous parallel direction optimizing Breadth First Traversal
+//   of an unweighted graph stored in compressed sparse row form
+// Each level is expanded either top-down from a list of frontier vertices,
+//   or bottom-up where each unvisited vertex scans its incoming edges for a
+//   parent in a bitmap of the frontier, whichever is expected to examine
+//   fewer edges
+// Vertices are 0-indexed
+// Template Arguments:
+//   T: the type of the distances
+// Constructor Arguments:
+//   G: a graph with the fields ST and TO in the same form as StaticGraph,
+//     where the vertices adjacent to v are TO[ST[v]], ..., TO[ST[v + 1] - 1]
+//   GR: the reverse of the graph G, if G is directed, in the same form as G;
+//     if omitted, G is assumed to be undirected
+//   s: a single source vertex
+//   src: a vector of source vertices
+//   pool: the thread pool to run the search on
+//   INF: a value for infinity
+//   ALPHA: the search switches to bottom-up when the edges incident to the
+//     frontier exceed 1 / ALPHA of the edges incident to unvisited vertices
+//   BETA: the search switches back to top-down when the frontier contains
+//     less than 1 / BETA of the vertices
+// Fields:
+//   dist: vector of distance from the closest source vertex to each vertex,
+//     or INF if unreachable, identical to the distances computed by BFS
+//   par: the parent vertex for each vertex in a breadth first search tree,
+//     which may differ from the tree computed by BFS as any vertex in the
+//     previous level can be chosen as the parent
+// Functions:
+//   getPath(v): returns the list of edges on the path from the closest
+//     source vertex to vertex v
+// In practice, constructor has a moderate constant, is slower than BFS on
+//   high diameter graphs and with a single thread, and is faster than BFS
+//   on low diameter graphs, even with a single thread
+// Time Complexity:
+//   constructor: O(V + E) total work, O((V + E) / P + D P) with P threads,
+//     where D is the diameter
+//   getPath: O(V)
+// Memory Complexity: O(V + P) additional memory
+// Tested:
+//   Stress Tested
+template <class T = int> struct ParallelBFS {
+  using Edge = tuple<int, int, T>; vector<T> dist; vector<int> par; T INF;
+  template <class Graph> static long long deg(const Graph &G, int v) {
+    return G.ST[v + 1] - G.ST[v];
+  }
+  template <class Graph>
+  ParallelBFS(const Graph &G, const Graph &GR, const vector<int> &srcs,
+              ThreadPool &pool, T INF = numeric_limits<T>::max(),
+              long long ALPHA = 15, long long BETA = 18)
+      : dist(G.size(), INF), par(G.size(), -1), INF(INF) {
+    int V = G.size(), W = (V + 63) / 64, P = pool.size();
+    vector<int> front; vector<uint64_t> cur(W, 0), nxt(W, 0);
+    vector<vector<int>> local(P); vector<long long> nf(P), mf(P);
+    long long totF = 0, totM = 0, unexplored = G.ST[V];
+    for (int s : srcs) if (par[s] == -1) {
+      par[s] = s; dist[s] = T(); front.push_back(s); totM += deg(G, s);
+    }
+    totF = front.size(); unexplored -= totM; bool bottomUp = false;
+    auto gather = [&] {
+      front.clear(); for (int t = 0; t < P; t++) {
+        front.insert(front.end(), local[t].begin(), local[t].end());
+        local[t].clear();
+      }
+    };
+    auto test = [&] (int v) { return (cur[v >> 6] >> (v & 63)) & 1; };
+    for (int lvl = 1; totF > 0; lvl++) {
+      if (!bottomUp && totM * ALPHA > unexplored) {
+        bottomUp = true; fill(cur.begin(), cur.end(), 0);
+        pool.parallelFor(front.size(), [&] (int, long long lo, long long hi) {
+          for (long long i = lo; i < hi; i++) __sync_fetch_and_or(
+              &cur[front[i] >> 6], uint64_t(1) << (front[i] & 63));
+        });
+      } else if (bottomUp && totF * BETA < V) {
+        bottomUp = false;
+        pool.parallelFor(W, [&] (int t, long long lo, long long hi) {
+          for (long long i = lo; i < hi; i++)
+            for (uint64_t b = cur[i]; b; b &= b - 1)
+              local[t].push_back(i * 64 + __builtin_ctzll(b));
+        });
+        gather();
+      }
+      fill(nf.begin(), nf.end(), 0); fill(mf.begin(), mf.end(), 0);
+      if (bottomUp) {
+        pool.parallelFor(W, [&] (int t, long long lo, long long hi) {
+          for (long long i = lo; i < hi; i++) {
+            nxt[i] = 0; int en = min(V, int(i * 64 + 64));
+            for (int v = i * 64; v < en; v++) if (par[v] == -1) {
+              for (int e = GR.ST[v]; e < GR.ST[v + 1]; e++) {
+                int w = GR.TO[e]; if (test(w)) {
+                  par[v] = w; dist[v] = T(lvl); nf[t]++; mf[t] += deg(G, v);
+                  nxt[i] |= uint64_t(1) << (v & 63); break;
+                }
+              }
+            }
+          }
+        }, 256);
+        cur.swap(nxt); totF = accumulate(nf.begin(), nf.end(), 0LL);
+      } else {
+        pool.parallelFor(front.size(), [&] (int t, long long lo,
+                                            long long hi) {
+          for (long long i = lo; i < hi; i++) {
+            int v = front[i]; for (int e = G.ST[v]; e < G.ST[v + 1]; e++) {
+              int w = G.TO[e]; if (__atomic_load_n(&par[w], __ATOMIC_RELAXED)
+                  == -1 && __sync_bool_compare_and_swap(&par[w], -1, v)) {
+                dist[w] = T(lvl); local[t].push_back(w); mf[t] += deg(G, w);
+              }
+            }
+          }
+        }, 64);
+        gather(); totF = front.size();
+      }
+      unexplored -= totM = accumulate(mf.begin(), mf.end(), 0LL);
+    }
+    for (int s : srcs) par[s] = -1;
+  }
+  template <class Graph>
+  ParallelBFS(const Graph &G, const vector<int> &srcs, ThreadPool &pool,
+              T INF = numeric_limits<T>::max())
+      : ParallelBFS(G, G, srcs, pool, INF) {}
+  template <class Graph>
+  ParallelBFS(const Graph &G, int s, ThreadPool &pool,
+              T INF = numeric_limits<T>::max())
+      : ParallelBFS(G, G, vector<int>(1, s), pool, INF) {}
+  vector<Edge> getPath(int v) {
+    vector<Edge> path; for (; par[v] != -1; v = par[v])
+      path.emplace_back(par[v], v, dist[v] - dist[par[v]]);
+    reverse(path.begin(), path.end()); return path;
+  }
+};
@@ -0,0 +1,141 @@
+#pragma once
+#include <bits/stdc++.h>
+#include "../../utils/ThreadPool.h"
+using namespace std;
+
+// Parallel delta stepping single source shortest path algorithm for
+//   weighted graphs without negative weights
+// Vertices are placed in buckets of width delta by their tentative distance,
+//   and the smallest nonempty bucket is repeatedly emptied by relaxing the
+//   light edges (with weight at most delta) of its vertices in parallel,
+//   after which the heavy edges of every vertex removed from the bucket are
+//   relaxed in parallel
+// Each thread stores only its nonempty buckets in a map keyed by the bucket
+//   index, so the memory does not depend on the distances or on delta
+// Vertices are 0-indexed
+// Template Arguments:
+//   T: the type of the weight of the edges in the graph
+// Constructor Arguments:
+//   G: a generic weighted graph data structure
+//     with the [] operator (const) defined to iterate over the adjacency list
+//     (which is a list of pair<int, T> for a weighted graph with weights of
+//     type T), as well as a member function size() (const) that returns the
+//     number of vertices in the graph; the [] operator must be safe to call
+//     from multiple threads at once
+//   s: a single source vertex
+//   src: a vector of source vertices
+//   pool: the thread pool to run the algorithm on
+//   delta: the width of each bucket, which must be positive, or T() to
+//     select a width with autoDelta
+//   INF: a value for infinity
+// Fields:
+//   dist: vector of shortest distance from the closest source vertex to each
+//     vertex, or INF if unreachable, identical to the distances computed
+//     by DijkstraSSSP
+//   par: the parent vertex for each vertex in the shortest path tree, which
+//     may differ from the tree computed by DijkstraSSSP if there are
+//     multiple shortest paths to a vertex
+//   delta: the bucket width that was used
+// Functions:
+//   autoDelta(G): returns a bucket width equal to the maximum edge weight
+//     divided by the average degree, which gives each bucket roughly a
+//     constant number of relaxations per vertex on graphs with random weights
+//   getPath(v): returns the list of edges on the path from the closest
+//     source vertex to vertex v
+// In practice, constructor has a moderate constant, is slower than
+//   DijkstraSSSP with a single thread, and scales with the number of threads
+//   on graphs with a small weighted diameter relative to delta
+// Time Complexity:
+//   constructor: O((V + E) log V) total work on random weights
+//   getPath: O(V)
+// Memory Complexity: O(V + E) additional memory
+// Tested:
+//   Stress Tested
+template <class T> struct DeltaSteppingSSSP {
+  using Edge = tuple<int, int, T>;
+  vector<T> dist; vector<int> par; T INF, delta;
+  template <class WeightedGraph> static T autoDelta(const WeightedGraph &G) {
+    long long E = 0; T mx = T(); for (int v = 0; v < int(G.size()); v++)
+      for (auto &&e : G[v]) { E++; mx = max(mx, e.second); }
+    if (E == 0 || !(T() < mx)) return T(1);
+    T d = T(double(mx) * double(G.size()) / double(E));
+    return T() < d ? d : mx;
+  }
+  template <class WeightedGraph>
+  DeltaSteppingSSSP(const WeightedGraph &G, const vector<int> &srcs,
+                    ThreadPool &pool, T delta = T(),
+                    T INF = numeric_limits<T>::max())
+      : dist(G.size(), INF), par(G.size(), -1), INF(INF),
+        delta(T() < delta ? delta : autoDelta(G)) {
+    int V = G.size(), P = pool.size(), stamp = 0; long long b = 0;
+    vector<char> lock(V, 0); vector<int> claim(V, -1), front;
+    vector<map<long long, vector<int>>> bins(P);
+    vector<vector<int>> removed(P);
+    auto bucket = [&] (T d) { return (long long)(d / this->delta); };
+    auto load = [&] (int v) {
+      T d; __atomic_load(&dist[v], &d, __ATOMIC_RELAXED); return d;
+    };
+    auto relax = [&] (int t, int v, int w, T d) {
+      if (!(d < load(w))) return;
+      while (__sync_lock_test_and_set(&lock[w], 1));
+      bool upd = d < dist[w];
+      if (upd) { __atomic_store(&dist[w], &d, __ATOMIC_RELAXED); par[w] = v; }
+      __sync_lock_release(&lock[w]); if (!upd) return;
+      bins[t][bucket(d)].push_back(w);
+    };
+    auto claimed = [&] (int v) {
+      int c = claim[v];
+      return c != stamp && __sync_bool_compare_and_swap(&claim[v], c, stamp);
+    };
+    auto gather = [&] {
+      front.clear(); for (int t = 0; t < P; t++) {
+        auto it = bins[t].find(b); if (it == bins[t].end()) continue;
+        front.insert(front.end(), it->second.begin(), it->second.end());
+        bins[t].erase(it);
+      }
+    };
+    for (int s : srcs) {
+      dist[s] = T(); bins[0][0].push_back(s);
+    }
+    for (gather(); ; gather()) {
+      for (; !front.empty(); gather()) {
+        stamp++;
+        pool.parallelFor(front.size(), [&] (int t, long long lo,
+                                            long long hi) {
+          for (long long i = lo; i < hi; i++) {
+            int v = front[i]; T d = load(v);
+            if (bucket(d) != b || !claimed(v)) continue;
+            removed[t].push_back(v); for (auto &&e : G[v])
+              if (!(this->delta < e.second))
+                relax(t, v, e.first, d + e.second);
+          }
+        }, 256);
+      }
+      for (int t = 0; t < P; t++) {
+        front.insert(front.end(), removed[t].begin(), removed[t].end());
+        removed[t].clear();
+      }
+      stamp++;
+      pool.parallelFor(front.size(), [&] (int t, long long lo, long long hi) {
+        for (long long i = lo; i < hi; i++) {
+          int v = front[i]; if (!claimed(v)) continue;
+          T d = load(v); for (auto &&e : G[v])
+            if (this->delta < e.second) relax(t, v, e.first, d + e.second);
+        }
+      }, 256);
+      long long nb = LLONG_MAX; for (int t = 0; t < P; t++)
+        if (!bins[t].empty()) nb = min(nb, bins[t].begin()->first);
+      if (nb == LLONG_MAX) break;
+      b = nb;
+    }
+  }
+  template <class WeightedGraph>
+  DeltaSteppingSSSP(const WeightedGraph &G, int s, ThreadPool &pool,
+                    T delta = T(), T INF = numeric_limits<T>::max())
+      : DeltaSteppingSSSP(G, vector<int>(1, s), pool, delta, INF) {}
+  vector<Edge> getPath(int v) {
+    vector<Edge> path; for (; par[v] != -1; v = par[v])
+      path.emplace_back(par[v], v, dist[v] - dist[par[v]]);
+    reverse(path.begin(), path.end()); return path;
+  }
+};
@@ -1,12 +1,71 @@
 #pragma once
 #include <bits/stdc++.h>
+#include "../../datastructures/trees/heaps/IndexedDaryHeap.h"
+#include "../../datastructures/trees/heaps/RadixPriorityQueue.h"
 using namespace std;
 
+// Priority queue policies for DijkstraSSSP
+// Each policy is constructed with the number of vertices V, and supports
+//   the following functions:
+//   empty(): returns whether there are no more entries in the queue
+//   push(v, d): decreases the tentative distance of vertex v to d
+//   pop(): removes and returns a pair of (d, v) with the minimum d, where d
+//     may be greater than the current distance of v if the policy uses
+//     lazy deletion, in which case the entry is skipped
+
+// Binary heap (std::priority_queue) with lazy deletion
+// Time Complexity:
+//   constructor, empty: O(1)
+//   pop, push: O(log E)
+// Memory Complexity: O(E)
+template <class T> struct DijkstraBinaryHeapPQ {
+  std::priority_queue<pair<T, int>, vector<pair<T, int>>,
+                      greater<pair<T, int>>> PQ;
+  DijkstraBinaryHeapPQ(int) {}
+  bool empty() const { return PQ.empty(); }
+  void push(int v, const T &d) { PQ.emplace(d, v); }
+  pair<T, int> pop() { pair<T, int> ret = PQ.top(); PQ.pop(); return ret; }
+};
+
+// Radix heap with lazy deletion, for nonnegative integral weights
+// Time Complexity:
+//   constructor, empty, push: O(1)
+//   pop: O(B) amortized where B is the number of bits in T
+// Memory Complexity: O(E)
+template <class T> struct DijkstraRadixHeapPQ {
+  using U = typename make_unsigned<T>::type;
+  RadixPriorityQueue<U, int, greater<U>> PQ; DijkstraRadixHeapPQ(int) {}
+  bool empty() const { return PQ.empty(); }
+  void push(int v, const T &d) { PQ.push(U(d), v); }
+  pair<T, int> pop() {
+    pair<U, int> ret = PQ.pop(); return make_pair(T(ret.first), ret.second);
+  }
+};
+
+// Indexed D-ary heap with decrease key and no lazy deletion
+// Time Complexity:
+//   constructor: O(V)
+//   empty: O(1)
+//   pop: O(D log V / log D)
+//   push: O(log V / log D)
+// Memory Complexity: O(V)
+template <class T, const int D = 4> struct DijkstraIndexedHeapPQ {
+  IndexedDaryHeap<T, D, greater<T>> PQ; DijkstraIndexedHeapPQ(int V) : PQ(V) {}
+  bool empty() const { return PQ.empty(); }
+  void push(int v, const T &d) { PQ.push(v, d); }
+  pair<T, int> pop() { return PQ.pop(); }
+};
+
 // Dijkstra's single source shortest path algorithm for weighted graphs
 //   without negative weights
 // Vertices are 0-indexed
 // Template Arguments:
 //   T: the type of the weight of the edges in the graph
+//   PQ: the priority queue policy, see above; in practice,
+//     DijkstraRadixHeapPQ is the fastest for integral weights on sparse
+//     graphs, DijkstraIndexedHeapPQ uses the least memory and is slightly
+//     faster than DijkstraBinaryHeapPQ once the average degree is in the
+//     tens, and DijkstraBinaryHeapPQ is the fastest on small dense graphs
 // Constructor Arguments:
 //   G: a generic graph data structure (weighted or unweighted)
 //     with the [] operator (const) defined to iterate over the adjacency list
@@ -26,27 +85,25 @@ using namespace std;
 //     source vertex to vertex v
 // In practice, constructor has a small constant
 // Time Complexity:
-//   constructor: O((V + E) log E)
+//   constructor: O(V + E) calls to the functions of PQ
 //   getPath: O(V)
-// Memory Complexity: O(V + E)
+// Memory Complexity: O(V) in addition to the memory of PQ
 // Tested:
 //   https://judge.yosupo.jp/problem/shortest_path
 //   https://open.kattis.com/problems/shortestpath1
 //   https://dmoj.ca/problem/sssp
-template <class T> struct DijkstraSSSP {
+template <class T, class PQ = DijkstraBinaryHeapPQ<T>> struct DijkstraSSSP {
   using Edge = tuple<int, int, T>; vector<T> dist; vector<int> par; T INF;
   template <class WeightedGraph>
   DijkstraSSSP(const WeightedGraph &G, const vector<int> &srcs,
                T INF = numeric_limits<T>::max())
       : dist(G.size(), INF), par(G.size(), -1), INF(INF) {
-    std::priority_queue<pair<T, int>, vector<pair<T, int>>,
-                        greater<pair<T, int>>> PQ;
-    for (int s : srcs) PQ.emplace(dist[s] = T(), s);
-    while (!PQ.empty()) {
-      T d = PQ.top().first; int v = PQ.top().second; PQ.pop();
-      if (d > dist[v]) continue;
+    PQ pq(G.size()); for (int s : srcs) pq.push(s, dist[s] = T());
+    while (!pq.empty()) {
+      pair<T, int> p = pq.pop(); int v = p.second;
+      if (p.first > dist[v]) continue;
       for (auto &&e : G[v]) if (dist[e.first] > dist[v] + e.second)
-        PQ.emplace(dist[e.first] = dist[par[e.first] = v] + e.second, e.first);
+        pq.push(e.first, dist[e.first] = dist[par[e.first] = v] + e.second);
     }
   }
   template <class WeightedGraph> DijkstraSSSP(const WeightedGraph &G, int s,
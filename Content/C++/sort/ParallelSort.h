@@ -0,0 +1,34 @@
+#pragma once
+#include <bits/stdc++.h>
+#include "../utils/ThreadPool.h"
+using namespace std;
+
+// Sorts a range in parallel by sorting one contiguous block per thread
+//   with std::sort, then merging adjacent blocks in parallel rounds with
+//   std::inplace_merge
+// Function Arguments:
+//   st: an iterator to the first element of the range
+//   en: an iterator to the element after the last element of the range
+//   cmp: the comparator, defaults to less
+//   pool: a ThreadPool used to sort the range
+// In practice, has a small constant
+// Time Complexity: O((N / T) log N + N log T) for T threads
+// Memory Complexity: O(N) additional memory for the merges
+// Tested:
+//   Stress Tested
+template <class It, class Comparator>
+void parallel_sort(It st, It en, Comparator cmp, ThreadPool &pool) {
+  long long N = en - st; int T = pool.size();
+  if (T == 1 || N < (1 << 15)) { sort(st, en, cmp); return; }
+  auto bound = [&] (int t) { return st + N * min(t, T) / T; };
+  pool.run([&] (int t) { sort(bound(t), bound(t + 1), cmp); });
+  for (int w = 1; w < T; w *= 2) pool.run([&] (int t) {
+    if (t % (w * 2) == 0 && t + w < T)
+      inplace_merge(bound(t), bound(t + w), bound(t + w * 2), cmp);
+  });
+}
+
+template <class It> void parallel_sort(It st, It en, ThreadPool &pool) {
+  parallel_sort(st, en, less<typename iterator_traits<It>::value_type>(),
+                pool);
+}
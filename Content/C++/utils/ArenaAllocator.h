@@ -0,0 +1,145 @@
+#pragma once
+#include <bits/stdc++.h>
+using namespace std;
+
+// Bump allocator that hands out memory from chunks allocated on demand,
+//   where chunk k has a size of BASE * 2^k bytes, and where all memory
+//   allocated after a mark can be freed at once by rewinding to that mark
+// Memory in the arena is addressed by a 32-bit offset into the concatenation
+//   of the chunks, where offset 0 is never allocated
+// The arena never calls destructors, so objects with nontrivial destructors
+//   must be destroyed before their memory is rewound
+// An arena must only be used by one thread at a time, and threadArena()
+//   returns an arena local to the calling thread, so that any number of
+//   threads can allocate without locks
+// Functions:
+//   allocate(n, a): returns a pointer to n bytes aligned to a, which must be
+//     a power of 2
+//   mark(): returns a mark that can be passed to rewind
+//   rewind(m): frees all memory allocated after mark() returned m, keeping
+//     the chunks for reuse
+//   reset(): frees all memory, keeping the chunks for reuse
+//   release(): frees all memory and all chunks, which invalidates every
+//     pointer and offset into the arena
+//   offset(p): returns the offset of the pointer p, which must point into
+//     the arena, or 0 if p is null
+//   pointer(o): returns the pointer with the offset o, which must have been
+//     returned by offset since the last call to release, and is not checked
+// In practice, allocate is a few instructions in the common case, and is
+//   much faster than operator new
+// Time Complexity:
+//   allocate: O(1) amortized
+//   mark, rewind, reset, pointer: O(1)
+//   release, offset: O(C) for C chunks, where C <= MAXC
+// Memory Complexity: O(S) for S bytes allocated since the last release
+// Tested:
+//   Stress Tested
+struct Arena {
+  static constexpr int LGB = 16, MAXC = 16;
+  static constexpr size_t BASE = size_t(1) << LGB;
+  unique_ptr<char[]> chunks[MAXC]; int k; size_t off;
+  static size_t start(int k) { return BASE * ((size_t(1) << k) - 1); }
+  static size_t cap(int k) { return BASE << k; }
+  Arena() : k(0), off(1) {}
+  Arena(const Arena &) = delete;
+  Arena &operator = (const Arena &) = delete;
+  void *allocate(size_t n, size_t a) {
+    while (true) {
+      if (!chunks[k]) chunks[k].reset(new char[cap(k)]);
+      uintptr_t c = uintptr_t(chunks[k].get());
+      size_t o = ((c + off + a - 1) & ~uintptr_t(a - 1)) - c;
+      if (o + n <= cap(k)) { off = o + n; return chunks[k].get() + o; }
+      if (k + 1 == MAXC) throw bad_alloc();
+      k++; off = 0;
+    }
+  }
+  size_t mark() const { return start(k) + off; }
+  void rewind(size_t m) {
+    k = min(MAXC - 1, int(__lg(m / BASE + 1))); off = m - start(k);
+  }
+  void reset() { k = 0; off = 1; }
+  void release() { for (auto &&c : chunks) c.reset(); reset(); }
+  size_t offset(const void *p) const {
+    if (!p) return 0;
+    const char *q = static_cast<const char *>(p);
+    for (int i = 0; i < MAXC; i++) {
+      const char *c = chunks[i].get();
+      if (c && c <= q && q < c + cap(i)) return start(i) + (q - c);
+    }
+    throw invalid_argument("Pointer is not in the arena");
+  }
+  void *pointer(size_t o) const {
+    int i = int(__lg(o / BASE + 1)); return chunks[i].get() + (o - start(i));
+  }
+};
+
+Arena &threadArena() { static thread_local Arena A; return A; }
+
+// Marks an arena when constructed, and rewinds it to that mark when
+//   destroyed, freeing everything allocated in the arena during its lifetime
+// Constructor Arguments:
+//   A: the arena, threadArena() by default
+// Time Complexity:
+//   constructor, destructor: O(1)
+// Memory Complexity: O(1)
+// Tested:
+//   Stress Tested
+struct ArenaScope {
+  Arena &A; size_t m;
+  ArenaScope(Arena &A = threadArena()) : A(A), m(A.mark()) {}
+  ArenaScope(const ArenaScope &) = delete;
+  ArenaScope &operator = (const ArenaScope &) = delete;
+  ~ArenaScope() { A.rewind(m); }
+};
+
+// Allocator class to be used with stl data structures, which allocates from
+//   an arena and never frees memory by itself
+// Constructor Arguments:
+//   A: the arena, threadArena() of the constructing thread by default
+// Time Complexity:
+//   allocate: O(1) amortized
+//   deallocate: O(1)
+// Memory Complexity: O(1) per allocator
+// Tested:
+//   Stress Tested
+template <class T> struct ArenaAllocator {
+  using value_type = T; Arena *A;
+  ArenaAllocator(Arena &A = threadArena()) : A(&A) {}
+  template <class U> ArenaAllocator(const ArenaAllocator<U> &a) : A(a.A) {}
+  T *allocate(size_t n) {
+    return static_cast<T *>(A->allocate(n * sizeof(T), alignof(T)));
+  }
+  void deallocate(T *, size_t) {}
+  template <class U> bool operator == (const ArenaAllocator<U> &a) const {
+    return A == a.A;
+  }
+  template <class U> bool operator != (const ArenaAllocator<U> &a) const {
+    return A != a.A;
+  }
+};
+
+// 32-bit pointer to an object in the arena returned by getArena, which is
+//   threadArena() by default
+// The offset is decoded in the arena returned by getArena on the
+//   dereferencing thread, so with the default getArena, an arena_ptr can only
+//   be dereferenced by the thread that created it; to share arena_ptrs
+//   between threads, getArena must return an arena shared by those threads,
+//   which must not be allocated from while other threads dereference it
+// Time Complexity:
+//   constructor: O(C) for C chunks in the arena
+//   operator *, operator ->, operator []: O(1)
+// Memory Complexity: O(1)
+// Tested:
+//   Stress Tested
+template <class T, Arena &(*getArena)() = threadArena> struct arena_ptr {
+  unsigned ind;
+  arena_ptr(T *p = nullptr) : ind(getArena().offset(p)) {}
+  T &operator * () const {
+    return *static_cast<T *>(getArena().pointer(ind));
+  }
+  T *operator -> () const { return &**this; }
+  T &operator [] (int a) const { return (&**this)[a]; }
+  explicit operator bool () const { return ind; }
+  bool operator == (const arena_ptr &p) const { return ind == p.ind; }
+  bool operator != (const arena_ptr &p) const { return ind != p.ind; }
+};
@@ -0,0 +1,30 @@
+#pragma once
+#include <bits/stdc++.h>
+using namespace std;
+
+// Block size and alignment for structures that store groups of B elements
+//   of type T in 64 byte cache lines
+// Template Arguments:
+//   T: the type of each element
+// Fields:
+//   B: the number of elements in a block, which is 64 / sizeof(T) rounded
+//     down to a power of 2, and at least 2
+//   LGB: the base 2 logarithm of B
+// Functions:
+//   offset(p): returns the number of elements to skip after p so that the
+//     next element starts a cache line, or 0 if that is at least B elements
+// Time Complexity:
+//   offset: O(1)
+// Memory Complexity: O(1)
+// Tested:
+//   Fuzz and Stress Tested (through BlockedFenwickTree1D and
+//     SegmentTreeBottomUp)
+template <class T> struct CacheLineBlock {
+  static constexpr int lg(int x) { return x <= 1 ? 0 : 1 + lg(x / 2); }
+  static constexpr int LGB = sizeof(T) >= 32 ? 1 : lg(64 / sizeof(T));
+  static constexpr int B = 1 << LGB;
+  static int offset(const T *p) {
+    size_t s = (64 - uintptr_t(p) % 64) % 64 / sizeof(T);
+    return s >= size_t(B) ? 0 : int(s);
+  }
+};
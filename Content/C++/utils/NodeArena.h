@@ -0,0 +1,79 @@
+#pragma once
+#include <bits/stdc++.h>
+using namespace std;
+
+// Typed arena of nodes referenced by 32-bit indices, where nodes are
+//   allocated by appending them to a vector, and every node allocated after
+//   a mark can be freed at once by rewinding to that mark
+// Index 0 is never allocated, and can be used as a null index
+// Template Arguments:
+//   Node: the type of the nodes
+// Functions:
+//   make(args...): constructs a node with the arguments args and returns its
+//     index
+//   operator [](i): returns a reference to the node with index i, which is
+//     invalidated by the next call to make
+//   size(): returns the number of allocated nodes
+//   mark(): returns a mark that can be passed to rewind
+//   rewind(m): frees all nodes that were allocated after mark() returned m
+//   reserve(n): reserves space for n nodes
+//   clear(): frees all nodes
+// In practice, has a very small constant
+// Time Complexity:
+//   make, operator [], size, mark, reserve: O(1) amortized
+//   rewind, clear: O(K) destructor calls for K freed nodes
+// Memory Complexity: O(N) for N nodes
+// Tested:
+//   Stress Tested
+template <class Node> struct NodeArena {
+  vector<Node> A;
+  template <class ...Args> int make(Args &&...args) {
+    A.emplace_back(forward<Args>(args)...); return int(A.size());
+  }
+  Node &operator [] (int i) { return A[i - 1]; }
+  const Node &operator [] (int i) const { return A[i - 1]; }
+  int size() const { return A.size(); }
+  int mark() const { return A.size(); }
+  void rewind(int m) { A.erase(A.begin() + m, A.end()); }
+  void reserve(int n) { A.reserve(n); }
+  void clear() { A.clear(); }
+};
+
+// Node pool policies for persistent structures, where ptr is the type used
+//   to reference a node, a value initialized ptr is null and converts to
+//   false, make(args...) constructs a node and returns a ptr to it,
+//   and operator [](x) returns a reference to the node x
+// SharedPtrPool allocates each node with make_shared, so nodes are freed
+//   when they are no longer reachable from any version
+// ArenaPool allocates nodes in a NodeArena that is shared between all copies
+//   of the pool, so nodes are only freed by clear() or rewind(m) with a mark
+//   m from mark(), which frees every node allocated afterwards, including
+//   every version created afterwards
+// Template Arguments:
+//   Node: the type of the nodes
+// In practice, ArenaPool has a much smaller constant and uses less memory
+//   per node than SharedPtrPool
+// Time Complexity:
+//   constructor, make, operator []: O(1) amortized
+// Memory Complexity: O(N) for N nodes
+// Tested:
+//   Stress Tested
+template <class Node> struct SharedPtrPool {
+  using ptr = shared_ptr<Node>;
+  template <class ...Args> ptr make(Args &&...args) {
+    return make_shared<Node>(forward<Args>(args)...);
+  }
+  Node &operator [] (const ptr &x) const { return *x; }
+};
+
+template <class Node> struct ArenaPool {
+  using ptr = int; shared_ptr<NodeArena<Node>> arena;
+  ArenaPool() : arena(make_shared<NodeArena<Node>>()) {}
+  template <class ...Args> ptr make(Args &&...args) {
+    return arena->make(forward<Args>(args)...);
+  }
+  Node &operator [] (ptr x) const { return (*arena)[x]; }
+  int mark() const { return arena->mark(); }
+  void rewind(int m) { arena->rewind(m); }
+  void clear() { arena->clear(); }
+};
@@ -0,0 +1,120 @@
+#pragma once
+#include <bits/stdc++.h>
+#include "ThreadPool.h"
+using namespace std;
+
+// Functions for prefix sums (scans) and reductions over a range with an
+//   associative operation op, which may be done in parallel with a
+//   ThreadPool
+// The parallel versions split the range into one contiguous block per
+//   thread, reduce each block in parallel, scan the block totals, and then
+//   scan each block in parallel starting from the total of the blocks
+//   before it, so that each element is read twice and written once
+// Reductions of operations with is_commutative<Op> defined as true use W
+//   independent accumulators, which allows the compiler to vectorize them;
+//   is_commutative is true for plus, multiplies, bit_and, bit_or and
+//   bit_xor, and can be specialized for other operations
+// The output may be the same as the input
+// Template Arguments:
+//   It: a random access iterator type
+//   OutIt: a random access iterator type for the output
+//   T: the type of the values
+//   Op: a struct with the operation (can also be of type
+//       std::function<T(T, T)>); in practice, custom struct is faster
+//       than std::function
+//     Required Functions:
+//       operator (l, r): combines the values l and r, must be associative
+// Function Arguments:
+//   st: an iterator pointing to the first element in the range
+//   en: an iterator pointing to after the last element in the range
+//   out: an iterator pointing to the first element of the output
+//   init: the value that is combined before the first element
+//   op: an instance of the Op struct
+//   pool: a ThreadPool used to scan the range in parallel, which is only
+//     used for ranges of at least 2^16 elements
+// Functions:
+//   reduceRange(st, en, init, op): returns init combined with every element
+//     in [st, en)
+//   inclusiveScan(st, en, out, init, op): sets out[i] to init combined with
+//     the first i + 1 elements, and returns init combined with every element
+//   exclusiveScan(st, en, out, init, op): sets out[i] to init combined with
+//     the first i elements, and returns init combined with every element
+// In practice, has a small constant, and the parallel versions are only
+//   faster when the range does not fit in cache or when T is expensive to
+//   combine, since a scan is limited by memory bandwidth
+// Time Complexity:
+//   reduceRange, inclusiveScan, exclusiveScan: O(N)
+//   parallel inclusiveScan, exclusiveScan: O(N / P + P) with P threads
+// Memory Complexity: O(1) additional memory, O(P) for the parallel versions
+// Tested:
+//   Fuzz and Stress Tested
+template <class Op> struct is_commutative : false_type {};
+template <class T> struct is_commutative<plus<T>> : true_type {};
+template <class T> struct is_commutative<multiplies<T>> : true_type {};
+template <class T> struct is_commutative<bit_and<T>> : true_type {};
+template <class T> struct is_commutative<bit_or<T>> : true_type {};
+template <class T> struct is_commutative<bit_xor<T>> : true_type {};
+
+template <class It, class T, class Op>
+T reduceRange(It st, It en, T init, Op op, false_type) {
+  for (; st != en; ++st) init = op(init, *st);
+  return init;
+}
+
+template <class It, class T, class Op>
+T reduceRange(It st, It en, T init, Op op, true_type) {
+  const int W = 8; long long N = en - st;
+  if (N < W * 2) return reduceRange(st, en, init, op, false_type());
+  T acc[W]; for (int j = 0; j < W; j++) acc[j] = st[j];
+  long long i = W; for (; i + W <= N; i += W)
+    for (int j = 0; j < W; j++) acc[j] = op(acc[j], st[i + j]);
+  for (; i < N; i++) acc[0] = op(acc[0], st[i]);
+  for (int j = 0; j < W; j++) init = op(init, acc[j]);
+  return init;
+}
+
+template <class It, class T, class Op = plus<T>>
+T reduceRange(It st, It en, T init, Op op = Op()) {
+  return reduceRange(st, en, init, op, is_commutative<Op>());
+}
+
+template <class It, class OutIt, class T, class Op = plus<T>>
+T inclusiveScan(It st, It en, OutIt out, T init, Op op = Op()) {
+  for (; st != en; ++st, ++out) *out = init = op(init, *st);
+  return init;
+}
+
+template <class It, class OutIt, class T, class Op = plus<T>>
+T exclusiveScan(It st, It en, OutIt out, T init, Op op = Op()) {
+  for (; st != en; ++st, ++out) { T v = *st; *out = init; init = op(init, v); }
+  return init;
+}
+
+template <const bool INCLUSIVE, class It, class OutIt, class T, class Op>
+T parallelScan(It st, It en, OutIt out, T init, Op op, ThreadPool &pool) {
+  long long N = en - st; int P = pool.size(); if (P == 1 || N < (1 << 16))
+    return INCLUSIVE ? inclusiveScan(st, en, out, init, op)
+                     : exclusiveScan(st, en, out, init, op);
+  vector<T> off(P + 1, init);
+  pool.run([&] (int t) {
+    long long lo = N * t / P, hi = N * (t + 1) / P;
+    off[t + 1] = reduceRange(st + lo + 1, st + hi, T(st[lo]), op);
+  });
+  for (int t = 0; t < P; t++) off[t + 1] = op(off[t], off[t + 1]);
+  pool.run([&] (int t) {
+    long long lo = N * t / P, hi = N * (t + 1) / P;
+    if (INCLUSIVE) inclusiveScan(st + lo, st + hi, out + lo, off[t], op);
+    else exclusiveScan(st + lo, st + hi, out + lo, off[t], op);
+  });
+  return off[P];
+}
+
+template <class It, class OutIt, class T, class Op>
+T inclusiveScan(It st, It en, OutIt out, T init, Op op, ThreadPool &pool) {
+  return parallelScan<true>(st, en, out, init, op, pool);
+}
+
+template <class It, class OutIt, class T, class Op>
+T exclusiveScan(It st, It en, OutIt out, T init, Op op, ThreadPool &pool) {
+  return parallelScan<false>(st, en, out, init, op, pool);
+}
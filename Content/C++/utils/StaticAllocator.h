@@ -3,9 +3,12 @@
 using namespace std;
 
 // Static allocator to improve the speed of memory access
+// Overrides the global new and delete operators, never frees memory, and is
+//   not thread safe; see ArenaAllocator.h for a scoped, thread safe arena
 // Tested:
 //   https://dmoj.ca/problem/wac4p5
 //   https://dmoj.ca/problem/ioi12p3
+//   Stress Tested
 constexpr int MB = 200;
 char buf[MB << 20]; size_t buf_ind = sizeof(buf);
 
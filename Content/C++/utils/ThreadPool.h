@@ -0,0 +1,78 @@
+#pragma once
+#include <bits/stdc++.h>
+using namespace std;
+
+// Thread pool with a fixed set of worker threads for fork-join parallelism
+// Each call to run or parallelFor blocks until every task has completed,
+//   and neither should be called from within a task
+// Constructor Arguments:
+//   T: the number of threads to use, including the calling thread,
+//     defaults to the number of hardware threads
+// Functions:
+//   size(): returns the number of threads
+//   run(f): calls f(t) exactly once for each thread index t in the
+//     range [0, T), with f(0) being called on the calling thread
+//   parallelFor(N, f, grain): splits the range [0, N) into disjoint
+//     contiguous blocks and calls f(t, lo, hi) for each block [lo, hi) where
+//     t is the index of the thread running the block; if grain is positive,
+//     blocks of grain elements are handed out dynamically, otherwise
+//     thread t receives the t-th of T blocks of equal size
+//   parallelFor(pool, N, f, grain): calls pool->parallelFor(N, f, grain) if
+//     pool is not null, and f(0, 0, N) on the calling thread otherwise
+// In practice, run and parallelFor have a moderate constant (a few
+//   microseconds of synchronization), and should only be used when
+//   each thread has a large amount of work
+// Time Complexity:
+//   constructor, run, parallelFor: O(T) excluding the time spent in f,
+//     O(1) for parallelFor with a null pool
+// Memory Complexity: O(T)
+// Tested:
+//   Stress Tested
+struct ThreadPool {
+  int T, gen, rem; bool stop; function<void(int)> job; mutex m;
+  condition_variable startCV, doneCV; vector<thread> workers;
+  ThreadPool(int T = max(1, int(thread::hardware_concurrency())))
+      : T(max(1, T)), gen(0), rem(0), stop(false) {
+    for (int t = 1; t < this->T; t++) workers.emplace_back([this, t] {
+      for (int g = 0; ; ) {
+        {
+          unique_lock<mutex> lock(m);
+          startCV.wait(lock, [&] { return stop || gen != g; });
+          if (stop) return;
+          g = gen;
+        }
+        job(t); lock_guard<mutex> lock(m);
+        if (--rem == 0) doneCV.notify_one();
+      }
+    });
+  }
+  ~ThreadPool() {
+    { lock_guard<mutex> lock(m); stop = true; }
+    startCV.notify_all(); for (auto &&w : workers) w.join();
+  }
+  int size() const { return T; }
+  template <class F> void run(F f) {
+    if (T == 1) { f(0); return; }
+    { lock_guard<mutex> lock(m); job = f; rem = T - 1; gen++; }
+    startCV.notify_all(); f(0); unique_lock<mutex> lock(m);
+    doneCV.wait(lock, [&] { return rem == 0; });
+  }
+  template <class F> void parallelFor(long long N, F f, long long grain = 0) {
+    if (grain <= 0) run([&] (int t) {
+      long long lo = N * t / T, hi = N * (t + 1) / T;
+      if (lo < hi) f(t, lo, hi);
+    });
+    else {
+      atomic<long long> nxt(0); run([&] (int t) {
+        for (long long lo; (lo = nxt.fetch_add(grain)) < N; )
+          f(t, lo, min(N, lo + grain));
+      });
+    }
+  }
+};
+
+template <class F>
+void parallelFor(ThreadPool *pool, long long N, F f, long long grain = 0) {
+  if (pool) pool->parallelFor(N, f, grain);
+  else if (N > 0) f(0, 0LL, N);
+}
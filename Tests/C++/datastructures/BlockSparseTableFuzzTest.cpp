@@ -0,0 +1,47 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/datastructures/BlockSparseTable.h"
+using namespace std;
+
+struct Min { int operator () (int a, int b) { return min(a, b); } };
+
+template <const int LGB>
+void test(int subtest, int MAXN, ThreadPool *pool) {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1e5;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % (MAXN + 1);
+    vector<int> A(N);
+    for (auto &&a : A) a = rng() % int(1e9) + 1;
+    using Table = BlockSparseTable<int, Min, LGB>;
+    Table ST = pool ? Table(A.begin(), A.end(), *pool)
+                    : Table(A.begin(), A.end());
+    int Q = N == 0 ? 0 : 100 - rng() % 5;
+    vector<int> ans0, ans1;
+    for (int i = 0; i < Q; i++) {
+      int l = rng() % N, r = rng() % N;
+      if (l > r) swap(l, r);
+      int mn = A[l];
+      for (int j = l + 1; j <= r; j++) mn = min(mn, A[j]);
+      ans0.push_back(mn);
+      ans1.push_back(ST.query(l, r));
+    }
+    assert(ans0 == ans1);
+    for (auto &&a : ans0) checkSum = (31 * checkSum + a) % (long long)(1e9 + 7);
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest " << subtest << " Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  ThreadPool pool(4);
+  test<2>(1, 100, nullptr);
+  test<6>(2, 1000, nullptr);
+  test<3>(3, 100, &pool);
+  cout << "Test Passed" << endl;
+  return 0;
+}
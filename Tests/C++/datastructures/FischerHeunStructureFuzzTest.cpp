@@ -15,9 +15,11 @@ void test1() {
     FischerHeunStructure<int, greater<int>> ST(A.begin(), A.end());
     int Q = N == 0 ? 0 : 100 - rng() % 5;
     vector<int> ans0, ans1, ansA0, ansA1;
+    vector<pair<int, int>> queries;
     for (int i = 0; i < Q; i++) {
       int l = rng() % N, r = rng() % N;
       if (l > r) swap(l, r);
+      queries.emplace_back(l, r);
       int mnInd = l;
       for (int j = l + 1; j <= r; j++) if (A[mnInd] > A[j]) mnInd = j;
       ans0.push_back(mnInd);
@@ -27,6 +29,8 @@ void test1() {
     }
     assert(ans0 == ans1);
     assert(ansA0 == ansA1);
+    assert(ST.queryInd(queries) == ans1);
+    assert(ST.query(queries) == ansA1);
     for (auto &&a : ans0) checkSum = (31 * checkSum + a) % (long long)(1e9 + 7);
   }
   const auto end_time = chrono::system_clock::now();
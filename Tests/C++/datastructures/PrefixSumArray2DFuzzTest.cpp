@@ -131,10 +131,50 @@ void test3() {
   cout << "  Checksum: " << checkSum << endl;
 }
 
+void test4() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1e4;
+  ThreadPool pool(4);
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 101;
+    int M = rng() % 201;
+    vector<vector<long long>> A(N, vector<long long>(M)), B = A, C = A, D = A;
+    for (int i = 0; i < N; i++) for (int j = 0; j < M; j++) A[i][j] = rng() % int(1e6) + 1;
+    adjacent_difference_2d(A, N, M, B);
+    adjacent_difference_2d(A, N, M, C, pool);
+    assert(B == C);
+    D = C;
+    adjacent_difference_2d(D, N, M, D, pool);
+    partial_sum_2d(D, N, M, D, pool);
+    assert(C == D);
+    partial_sum_2d(C, N, M, D, pool);
+    assert(A == D);
+    partial_sum_2d(A, N, M, B);
+    partial_sum_2d(A, N, M, A, pool);
+    assert(A == B);
+    for (int i = 0; i < N; i++) for (int j = 0; j < M; j++) {
+      long long v = C[i][j];
+      if (i > 0) v += D[i - 1][j];
+      if (j > 0) v += D[i][j - 1];
+      if (i > 0 && j > 0) v -= D[i - 1][j - 1];
+      assert(v == D[i][j]);
+    }
+    if (N > 0 && M > 0) checkSum = (31 * checkSum + A[N - 1][M - 1]) % (long long)(1e9 + 7);
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 4 (std::vector, ThreadPool) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
 int main() {
   test1();
   test2();
   test3();
+  test4();
   cout << "Test Passed" << endl;
   return 0;
 }
@@ -234,6 +234,51 @@ void test6() {
   cout << "  Checksum: " << checkSum << endl;
 }
 
+void test7() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int N = 1 << 14, M = 1 << 14;
+  vector<vector<long long>> D(N, vector<long long>(M));
+  for (auto &&row : D) for (auto &&a : row) a = rng() % int(1e5) + 1;
+  auto t = chrono::system_clock::now();
+  partial_sum_2d(D, N, M, D);
+  auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - t).count() / double(chrono::system_clock::period::den));
+  cout << "  partial_sum_2d: " << fixed << setprecision(3) << sec
+       << "s" << endl;
+  t = chrono::system_clock::now();
+  adjacent_difference_2d(D, N, M, D);
+  end_time = chrono::system_clock::now();
+  sec = ((end_time - t).count() / double(chrono::system_clock::period::den));
+  cout << "  adjacent_difference_2d: " << fixed << setprecision(3)
+       << sec << "s" << endl;
+  ThreadPool pool;
+  t = chrono::system_clock::now();
+  partial_sum_2d(D, N, M, D, pool);
+  end_time = chrono::system_clock::now();
+  sec = ((end_time - t).count() / double(chrono::system_clock::period::den));
+  cout << "  partial_sum_2d (" << pool.size() << " threads): " << fixed
+       << setprecision(3) << sec << "s" << endl;
+  long long sm = D[N - 1][M - 1];
+  t = chrono::system_clock::now();
+  adjacent_difference_2d(D, N, M, D, pool);
+  end_time = chrono::system_clock::now();
+  sec = ((end_time - t).count() / double(chrono::system_clock::period::den));
+  cout << "  adjacent_difference_2d (" << pool.size() << " threads): "
+       << fixed << setprecision(3) << sec << "s" << endl;
+  for (auto &&row : D) for (auto &&a : row) sm -= a;
+  assert(sm == 0);
+  cout << "Subtest 7 (std::vector, ThreadPool) Passed" << endl;
+  cout << "  N: " << N << endl;
+  cout << "  M: " << M << endl;
+  end_time = chrono::system_clock::now();
+  sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  long long checkSum = 0;
+  for (int i = 0; i < N; i += 97) checkSum = (31 * checkSum + D[i][i]) % (long long)(1e9 + 7);
+  cout << "  Checksum: " << checkSum << endl;
+}
+
 int main() {
   test1();
   test2();
@@ -241,6 +286,7 @@ int main() {
   test4();
   test5();
   test6();
+  test7();
   cout << "Test Passed" << endl;
   return 0;
 }
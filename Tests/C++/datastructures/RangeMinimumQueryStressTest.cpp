@@ -1,4 +1,5 @@
 #include <bits/stdc++.h>
+#include "../../../Content/C++/datastructures/BlockSparseTable.h"
 #include "../../../Content/C++/datastructures/DisjointSparseTable.h"
 #include "../../../Content/C++/datastructures/FischerHeunStructure.h"
 #include "../../../Content/C++/datastructures/SparseTable.h"
@@ -221,6 +222,85 @@ void test8() {
   cout << "  Checksum: " << checkSum << endl;
 }
 
+void test9() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  struct Min { int operator () (int a, int b) { return min(a, b); } };
+  int N = 2e6;
+  vector<int> A(N);
+  for (auto &&ai : A) ai = rng() % int(1e9) + 1;
+  BlockSparseTable<int, Min> ST(A.begin(), A.end());
+  int Q = 1;
+  vector<int> ans;
+  for (int i = 0; i < Q; i++) {
+    int l = rng() % N, r = rng() % N;
+    if (l > r) swap(l, r);
+    ans.push_back(ST.query(l, r));
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 9 (Block Sparse Table) Passed" << endl;
+  cout << "  N: " << N << endl;
+  cout << "  Q: " << Q << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  long long checkSum = 0;
+  for (auto &&a : ans) checkSum = (31 * checkSum + a) % (long long)(1e9 + 7);
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test10() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  struct Min { int operator () (int a, int b) { return min(a, b); } };
+  int N = 2e6;
+  vector<int> A(N);
+  for (auto &&ai : A) ai = rng() % int(1e9) + 1;
+  BlockSparseTable<int, Min> ST(A.begin(), A.end());
+  int Q = 1e7;
+  vector<int> ans;
+  for (int i = 0; i < Q; i++) {
+    int l = rng() % N, r = rng() % N;
+    if (l > r) swap(l, r);
+    ans.push_back(ST.query(l, r));
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 10 (Block Sparse Table) Passed" << endl;
+  cout << "  N: " << N << endl;
+  cout << "  Q: " << Q << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  long long checkSum = 0;
+  for (auto &&a : ans) checkSum = (31 * checkSum + a) % (long long)(1e9 + 7);
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test11() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  struct Min { int operator () (int a, int b) { return min(a, b); } };
+  int N = 2e8;
+  vector<int> A(N);
+  for (auto &&ai : A) ai = rng() % int(1e9) + 1;
+  ThreadPool pool;
+  BlockSparseTable<int, Min> ST(A.begin(), A.end(), pool);
+  int Q = 1e7;
+  vector<int> ans;
+  for (int i = 0; i < Q; i++) {
+    int l = rng() % N, r = rng() % N;
+    if (l > r) swap(l, r);
+    ans.push_back(ST.query(l, r));
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 11 (Block Sparse Table, parallel build) Passed" << endl;
+  cout << "  N: " << N << endl;
+  cout << "  Q: " << Q << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  long long checkSum = 0;
+  for (auto &&a : ans) checkSum = (31 * checkSum + a) % (long long)(1e9 + 7);
+  cout << "  Checksum: " << checkSum << endl;
+}
+
 int main() {
   test1();
   test2();
@@ -230,6 +310,9 @@ int main() {
   test6();
   test7();
   test8();
+  test9();
+  test10();
+  test11();
   cout << "Test Passed" << endl;
   return 0;
 }
@@ -0,0 +1,163 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/datastructures/trees/BPlusTree.h"
+using namespace std;
+
+struct SumCombine {
+  using Data = long long;
+  const Data qdef = 0;
+  Data merge(const Data &l, const Data &r) const { return l + r; }
+};
+
+struct CmpFirst {
+  bool operator () (const pair<int, int> &a, const pair<int, int> &b) const {
+    return a.first < b.first;
+  }
+};
+
+template <class Tree> int check(const Tree &T, int x, int lvl, int &leaf) {
+  if (lvl == 0) {
+    assert(T.L[x].prev == leaf); if (leaf != -1) assert(T.L[leaf].next == x);
+    leaf = x; return T.L[x].n;
+  }
+  int sz = 0;
+  for (int i = 0; i < T.I[x].n; i++) {
+    int c = T.I[x].ch[i], s = check(T, c, lvl - 1, leaf);
+    assert(s == T.I[x].cnt[i]); sz += s;
+    const auto &k = lvl == 1 ? T.L[c].key[T.L[c].n - 1]
+                             : T.I[c].key[T.I[c].n - 1];
+    assert(k == T.I[x].key[i]);
+  }
+  assert(sz == T.I[x].sz); return sz;
+}
+
+template <class Tree> void checkAll(const Tree &T) {
+  int leaf = -1; assert(check(T, T.root, T.h, leaf) == T.size());
+  assert(T.L[leaf].next == -1);
+}
+
+template <const int B> void test(int subtest) {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1e3;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 500, V = rng() % 1000 + 1;
+    vector<int> A(N);
+    for (auto &&a : A) a = rng() % V;
+    sort(A.begin(), A.end());
+    BPlusTree<int, less<int>, SumCombine, B> T(A.begin(), A.end());
+    checkAll(T);
+    int Q = 2000;
+    vector<long long> ans0, ans1;
+    for (int i = 0; i < Q; i++) {
+      int t = rng() % 6, v = rng() % V;
+      if (t == 0) {
+        T.insert(v); A.insert(upper_bound(A.begin(), A.end(), v), v);
+      } else if (t == 1) {
+        auto it = lower_bound(A.begin(), A.end(), v);
+        bool found = it != A.end() && *it == v;
+        if (found) A.erase(it);
+        assert(T.erase(v) == found);
+      } else if (t == 2) {
+        int lb = lower_bound(A.begin(), A.end(), v) - A.begin();
+        int ub = upper_bound(A.begin(), A.end(), v) - A.begin();
+        int N = A.size();
+        vector<pair<int, int>> exp = {
+          {lb - 1, lb - 1 >= 0 ? A[lb - 1] : -1},
+          {ub - 1, ub - 1 >= 0 ? A[ub - 1] : -1},
+          {lb, lb < N ? A[lb] : -1},
+          {ub, ub < N ? A[ub] : -1},
+          {lb < ub ? lb : N, lb < ub ? A[lb] : -1}
+        };
+        vector<pair<int, int *>> got = {
+          T.below(v), T.floor(v), T.ceiling(v), T.above(v), T.find(v)
+        };
+        for (int j = 0; j < 5; j++) {
+          ans0.push_back(exp[j].first); ans0.push_back(exp[j].second);
+          ans1.push_back(got[j].first);
+          ans1.push_back(got[j].second ? *got[j].second : -1);
+        }
+      } else if (t == 3 && !A.empty()) {
+        int k = rng() % A.size(); ans0.push_back(A[k]);
+        ans1.push_back(T.at(k));
+      } else if (t == 4 && !A.empty()) {
+        int l = rng() % A.size(), r = rng() % A.size();
+        if (l > r) swap(l, r);
+        long long sm = 0;
+        for (int j = l; j <= r; j++) sm += A[j];
+        ans0.push_back(sm); ans1.push_back(T.query(l, r));
+        vector<int> B0(A.begin() + l, A.begin() + r + 1), B1;
+        T.forEach(l, r, [&] (int x) { B1.push_back(x); });
+        assert(B0 == B1);
+      } else if (t == 5) {
+        assert(T.size() == int(A.size()));
+        assert(T.empty() == A.empty());
+      }
+    }
+    checkAll(T); assert(T.values() == A);
+    assert(ans0 == ans1);
+    for (auto &&a : ans0) checkSum = (31 * checkSum + a) % (long long)(1e9 + 7);
+    T.clear(); assert(T.empty() && T.values().empty());
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest " << subtest << " (B = " << B << ") Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+template <const int B> void testDuplicates(int subtest) {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1e3;
+  long long checkSum = 0;
+  CmpFirst cmp;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int V = rng() % 10 + 1, id = 0;
+    vector<pair<int, int>> A;
+    BPlusTree<pair<int, int>, CmpFirst, void, B> T;
+    int Q = 2000;
+    vector<int> ans0, ans1;
+    for (int i = 0; i < Q; i++) {
+      int t = rng() % 4;
+      pair<int, int> v(rng() % V, id++);
+      if (t <= 1) {
+        T.insert(v); A.insert(upper_bound(A.begin(), A.end(), v, cmp), v);
+      } else if (t == 2) {
+        auto it = lower_bound(A.begin(), A.end(), v, cmp);
+        bool found = it != A.end() && it->first == v.first;
+        if (found) A.erase(it);
+        assert(T.erase(v) == found);
+      } else if (!A.empty()) {
+        int k = rng() % A.size(); ans0.push_back(A[k].second);
+        ans1.push_back(T.at(k).second);
+        auto f = T.floor(v), c = T.ceiling(v);
+        int lb = lower_bound(A.begin(), A.end(), v, cmp) - A.begin();
+        int ub = upper_bound(A.begin(), A.end(), v, cmp) - A.begin();
+        assert(f.first == ub - 1 && c.first == lb);
+        ans0.push_back(ub > 0 ? A[ub - 1].second : -1);
+        ans1.push_back(f.second ? f.second->second : -1);
+        ans0.push_back(lb < int(A.size()) ? A[lb].second : -1);
+        ans1.push_back(c.second ? c.second->second : -1);
+      }
+    }
+    checkAll(T); assert(T.values() == A);
+    assert(ans0 == ans1);
+    for (auto &&a : ans0) checkSum = (31 * checkSum + a) % (long long)(1e9 + 7);
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest " << subtest << " (duplicates, B = " << B << ") Passed"
+       << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test<8>(1);
+  test<32>(2);
+  testDuplicates<8>(3);
+  testDuplicates<32>(4);
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,105 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/datastructures/PolicyBasedDataStructures.h"
+#include "../../../../Content/C++/datastructures/sqrt/RootArray.h"
+#include "../../../../Content/C++/datastructures/trees/BPlusTree.h"
+#include "../../../../Content/C++/datastructures/trees/binarysearchtrees/BSTNode.h"
+#include "../../../../Content/C++/datastructures/trees/binarysearchtrees/DynamicRangeOperations.cpp"
+#include "../../../../Content/C++/datastructures/trees/binarysearchtrees/Splay.h"
+#include "../../../../Content/C++/datastructures/trees/binarysearchtrees/Treap.h"
+using namespace std;
+
+struct BPlusTreeWrapper {
+  BPlusTree<int> T;
+  template <class It> BPlusTreeWrapper(It st, It en) : T(st, en) {}
+  void insert(int v) { T.insert(v); }
+  void erase(int v) { T.erase(v); }
+  int rank(int v) { return T.ceiling(v).first; }
+  int select(int k) { return T.at(k); }
+};
+
+template <class Tree> struct BSTWrapper {
+  DynamicRangeOperations<Tree> T; less<int> cmp;
+  template <class It> BSTWrapper(It st, It en) : T(st, en) {}
+  void insert(int v) { T.insert(v, cmp); }
+  void erase(int v) { T.erase(v, cmp); }
+  int rank(int v) { return T.lower_bound(v, cmp).first; }
+  int select(int k) { return T.at(k); }
+};
+
+struct RootArrayWrapper {
+  RootArray<3, int> T; less<int> cmp;
+  template <class It> RootArrayWrapper(It st, It en) : T(st, en) {}
+  void insert(int v) { T.insert(v, cmp); }
+  void erase(int v) { T.erase(v, cmp); }
+  int rank(int v) { return T.ceiling(v, cmp).first; }
+  int select(int k) { return T.at(k); }
+};
+
+struct TreesetWrapper {
+  treeset<int> T;
+  template <class It> TreesetWrapper(It st, It en) : T(st, en) {}
+  void insert(int v) { T.insert(v); }
+  void erase(int v) { T.erase(v); }
+  int rank(int v) { return T.order_of_key(v); }
+  int select(int k) { return *T.find_by_order(k); }
+};
+
+template <class Wrapper> void run(const string &name, const vector<int> &A,
+                                  const vector<pair<int, int>> &ops) {
+  const auto start_time = chrono::system_clock::now();
+  Wrapper W(A.begin(), A.end());
+  auto end_time = chrono::system_clock::now();
+  double buildTime = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  long long checkSum = 0; int N = A.size();
+  for (auto &&op : ops) {
+    if (op.first == 0) { W.insert(op.second); N++; }
+    else if (op.first == 1) { W.erase(op.second); N--; }
+    else if (op.first == 2)
+      checkSum = (31 * checkSum + W.rank(op.second)) % (long long)(1e9 + 7);
+    else checkSum = (31 * checkSum + W.select(op.second % N))
+        % (long long)(1e9 + 7);
+  }
+  cout << "  " << name << " Build Time: " << fixed << setprecision(3)
+       << buildTime << "s" << endl;
+  end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "  " << name << " Total Time: " << fixed << setprecision(3)
+       << sec << "s" << endl;
+  cout << "  " << name << " Checksum: " << checkSum << endl;
+}
+
+void test1() {
+  mt19937_64 rng(0);
+  int N = 1e6, Q = 1e6;
+  vector<int> P(N * 2);
+  for (int i = 0; i < N * 2; i++) P[i] = i * 2;
+  shuffle(P.begin(), P.end(), rng);
+  vector<int> A(P.begin(), P.begin() + N), rest(P.begin() + N, P.end());
+  sort(A.begin(), A.end());
+  vector<int> live = A; vector<pair<int, int>> ops;
+  for (int i = 0; i < Q; i++) {
+    int t = rng() % 10;
+    if (t == 0 && !rest.empty()) {
+      ops.emplace_back(0, rest.back()); live.push_back(rest.back());
+      rest.pop_back();
+    } else if (t == 1 && !live.empty()) {
+      int j = rng() % live.size(); ops.emplace_back(1, live[j]);
+      rest.push_back(live[j]); swap(live[j], live.back()); live.pop_back();
+    } else ops.emplace_back(t < 6 ? 2 : 3, rng() % (N * 4));
+  }
+  cout << "Subtest 1 (read heavy ordered set, rank and select) Passed"
+       << endl;
+  cout << "  N: " << N << endl;
+  cout << "  Q: " << Q << endl;
+  run<BPlusTreeWrapper>("BPlusTree", A, ops);
+  run<BSTWrapper<Splay<NodeVal<int>>>>("Splay", A, ops);
+  run<BSTWrapper<Treap<NodeVal<int>>>>("Treap", A, ops);
+  run<RootArrayWrapper>("RootArray", A, ops);
+  run<TreesetWrapper>("treeset", A, ops);
+}
+
+int main() {
+  test1();
+  cout << "Test Passed" << endl;
+  return 0;
+}
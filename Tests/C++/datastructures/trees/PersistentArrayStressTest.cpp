@@ -0,0 +1,87 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/datastructures/trees/PersistentArray.h"
+using namespace std;
+
+template <template <class> class Pool>
+void test(int subtest, const string &name) {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  int N = 1e6, Q = 2e6, V = 1000;
+  vector<int> A(N);
+  for (auto &&a : A) a = rng() % int(1e9);
+  vector<PersistentArray<int, Pool>> versions;
+  versions.reserve(V);
+  versions.emplace_back(A.begin(), A.end());
+  PersistentArray<int, Pool> cur = versions.back();
+  long long checkSum = 0;
+  for (int i = 0; i < Q; i++) {
+    int k = rng() % N;
+    if (rng() % 2) cur.set(k, rng() % int(1e9));
+    else {
+      int v = rng() % versions.size();
+      checkSum = (31 * checkSum + versions[v].get(k)) % (long long)(1e9 + 7);
+    }
+    if (i % (Q / V) == 0 && int(versions.size()) < V) versions.push_back(cur);
+  }
+  for (int i = 0; i < N; i += 1000)
+    checkSum = (31 * checkSum + cur.get(i)) % (long long)(1e9 + 7);
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  N: " << N << endl;
+  cout << "  Q: " << Q << endl;
+  cout << "  Node Size: " << sizeof(typename PersistentArray<int, Pool>::Node)
+       << " bytes" << endl;
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test3() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1e4;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 100 + 1, Q = 100;
+    vector<int> A(N);
+    for (auto &&a : A) a = rng() % int(1e9);
+    vector<vector<int>> history(1, A);
+    vector<PersistentArray<int, ArenaPool>> versions;
+    versions.emplace_back(A.begin(), A.end());
+    int mark = -1, markVersions = -1;
+    for (int i = 0; i < Q; i++) {
+      int t = rng() % 8;
+      if (t < 3) {
+        int v = rng() % versions.size(), k = rng() % N, x = rng() % int(1e9);
+        versions.push_back(versions[v]); versions.back().set(k, x);
+        history.push_back(history[v]); history.back()[k] = x;
+      } else if (t == 3) {
+        if (markVersions == -1) {
+          mark = versions[0].pool.mark(); markVersions = versions.size();
+        } else {
+          versions[0].pool.rewind(mark);
+          versions.erase(versions.begin() + markVersions, versions.end());
+          history.resize(markVersions);
+          markVersions = -1;
+        }
+      } else {
+        int v = rng() % versions.size(), k = rng() % N;
+        assert(versions[v].get(k) == history[v][k]);
+        checkSum = (31 * checkSum + history[v][k]) % (long long)(1e9 + 7);
+      }
+    }
+  }
+  cout << "Subtest 3 (ArenaPool with rewind) Passed" << endl;
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test<SharedPtrPool>(1, "SharedPtrPool");
+  test<ArenaPool>(2, "ArenaPool");
+  test3();
+  cout << "Test Passed" << endl;
+  return 0;
+}
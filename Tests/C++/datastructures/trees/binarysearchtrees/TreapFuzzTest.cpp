@@ -0,0 +1,113 @@
+#include <bits/stdc++.h>
+#include "../../../../../Content/C++/datastructures/trees/binarysearchtrees/BSTNode.h"
+#include "../../../../../Content/C++/datastructures/trees/binarysearchtrees/Treap.h"
+using namespace std;
+
+using Node = NodeVal<int>;
+using Tree = Treap<Node>;
+
+int check(Tree &T, Node *x, Node *p, vector<int> &vals) {
+  if (!x) return 0;
+  x->propagate(); assert(x->p == p);
+  if (p) assert(T.pri(x) <= T.pri(p));
+  int sz = check(T, x->l, x, vals); vals.push_back(x->val);
+  sz += 1 + check(T, x->r, x, vals); assert(sz == x->sz); return sz;
+}
+
+vector<int> values(Tree &T, Node *root) {
+  vector<int> vals; check(T, root, nullptr, vals); return vals;
+}
+
+Node *build(Tree &T, const vector<int> &A) {
+  auto st = A.begin(); return T.build(A.size(), [&] { return *st++; });
+}
+
+vector<int> randomSet(mt19937_64 &rng, int N, int V) {
+  vector<int> A(N);
+  for (auto &&a : A) a = rng() % V;
+  sort(A.begin(), A.end()); A.erase(unique(A.begin(), A.end()), A.end());
+  return A;
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1e4;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 200;
+    vector<int> A(N);
+    for (auto &&a : A) a = rng() % int(1e9);
+    Tree T; Node *root = build(T, A);
+    assert(values(T, root) == A);
+    if (N > 0) {
+      int l = rng() % N, r = rng() % N;
+      if (l > r) swap(l, r);
+      T.applyToRange(root, l, r, [&] (Node *x) { x->reverse(); });
+      reverse(A.begin() + l, A.begin() + r + 1);
+      assert(values(T, root) == A);
+    }
+    for (auto &&a : A) checkSum = (31 * checkSum + a) % (long long)(1e9 + 7);
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (build) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2(int subtest, ThreadPool *pool) {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 3e3;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    Tree T; int V = rng() % 1000 + 1;
+    vector<int> A = randomSet(rng, rng() % 500, V);
+    vector<int> B = randomSet(rng, rng() % 500, V);
+    Node *a = build(T, A);
+    Node *b = build(T, B);
+    int op = rng() % 3; vector<int> C; Node *c = nullptr; less<int> cmp;
+    if (op == 0) {
+      set_union(A.begin(), A.end(), B.begin(), B.end(), back_inserter(C));
+      c = pool ? T.setUnion(a, b, cmp, *pool) : T.setUnion(a, b, cmp);
+    } else if (op == 1) {
+      set_intersection(A.begin(), A.end(), B.begin(), B.end(),
+                       back_inserter(C));
+      c = pool ? T.setIntersection(a, b, cmp, *pool)
+               : T.setIntersection(a, b, cmp);
+    } else {
+      set_difference(A.begin(), A.end(), B.begin(), B.end(),
+                     back_inserter(C));
+      c = pool ? T.setDifference(a, b, cmp, *pool)
+               : T.setDifference(a, b, cmp);
+    }
+    assert(values(T, c) == C);
+    assert(C.size() + T.deleted.size() == A.size() + B.size());
+    set<Node *> del(T.deleted.begin(), T.deleted.end());
+    assert(del.size() == T.deleted.size());
+    long long used = 0;
+    for (auto &&blk : T.blocks) used += blk.used;
+    T.clear(c); Node *d = build(T, B);
+    assert(values(T, d) == B);
+    long long used2 = 0;
+    for (auto &&blk : T.blocks) used2 += blk.used;
+    assert(used == used2);
+    for (auto &&v : C) checkSum = (31 * checkSum + v) % (long long)(1e9 + 7);
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest " << subtest << " (set operations, "
+       << (pool ? "parallel" : "sequential") << ") Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2(2, nullptr);
+  ThreadPool pool(3);
+  test2(3, &pool);
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,156 @@
+#include <bits/stdc++.h>
+#include "../../../../../Content/C++/datastructures/trees/binarysearchtrees/BSTNode.h"
+#include "../../../../../Content/C++/datastructures/trees/binarysearchtrees/Treap.h"
+using namespace std;
+
+using Node = NodeVal<int>;
+using Tree = Treap<Node>;
+
+Node *mergeBuild(Tree &T, const vector<int> &A, int l, int r) {
+  if (l > r) return nullptr;
+  if (l == r) return T.makeNode(A[l]);
+  int m = l + (r - l) / 2; Node *ret;
+  T.merge(ret, mergeBuild(T, A, l, m), mergeBuild(T, A, m + 1, r));
+  return ret;
+}
+
+Node *build(Tree &T, const vector<int> &A) {
+  auto st = A.begin(); return T.build(A.size(), [&] { return *st++; });
+}
+
+Node *insertAll(Tree &T, Node *root, const vector<int> &A) {
+  less<int> cmp;
+  for (auto &&a : A) {
+    pair<int, Node *> p = T.getFirst(root, a, cmp);
+    if (p.second && p.second->val == a) continue;
+    T.applyToRange(root, p.first, p.first - 1, [&] (Node *&x) {
+      x = T.makeNode(a);
+    });
+  }
+  return root;
+}
+
+long long checkSum(Tree &T, Node *root) {
+  long long ret = 0, sz = root ? root->sz : 0;
+  for (int i = 0; i < sz; i += 1000)
+    ret = (31 * ret + T.select(root, i)->val) % (long long)(1e9 + 7);
+  return ret;
+}
+
+long long checkSum(const set<int> &S) {
+  long long ret = 0; int i = 0;
+  for (auto &&v : S) if (i++ % 1000 == 0)
+    ret = (31 * ret + v) % (long long)(1e9 + 7);
+  return ret;
+}
+
+void test1() {
+  mt19937_64 rng(0);
+  int N = 1e7;
+  vector<int> A(N);
+  for (auto &&a : A) a = rng() % int(1e9);
+  sort(A.begin(), A.end()); A.erase(unique(A.begin(), A.end()), A.end());
+  N = A.size();
+  double setTime, mergeTime, buildTime; long long cs0, cs1, cs2;
+  {
+    auto start_time = chrono::system_clock::now();
+    Tree T; Node *root = build(T, A);
+    const auto end_time = chrono::system_clock::now();
+    buildTime = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    cs2 = checkSum(T, root);
+  }
+  {
+    auto start_time = chrono::system_clock::now();
+    Tree T; Node *root = mergeBuild(T, A, 0, N - 1);
+    const auto end_time = chrono::system_clock::now();
+    mergeTime = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    cs1 = checkSum(T, root);
+  }
+  {
+    auto start_time = chrono::system_clock::now();
+    set<int> S(A.begin(), A.end());
+    const auto end_time = chrono::system_clock::now();
+    setTime = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    cs0 = checkSum(S);
+  }
+  assert(cs0 == cs1 && cs1 == cs2);
+  cout << "Subtest 1 (build from sorted range) Passed" << endl;
+  cout << "  N: " << N << endl;
+  cout << "  std::set Time: " << fixed << setprecision(3) << setTime << "s"
+       << endl;
+  cout << "  Recursive Merge Time: " << fixed << setprecision(3)
+       << mergeTime << "s" << endl;
+  cout << "  Stack Build Time: " << fixed << setprecision(3) << buildTime
+       << "s" << endl;
+  cout << "  Checksum: " << cs0 << endl;
+}
+
+void test2() {
+  mt19937_64 rng(0);
+  int N = 2e6, V = 4e6;
+  vector<int> A(N), B(N);
+  for (auto &&a : A) a = rng() % V;
+  for (auto &&b : B) b = rng() % V;
+  sort(A.begin(), A.end()); A.erase(unique(A.begin(), A.end()), A.end());
+  sort(B.begin(), B.end()); B.erase(unique(B.begin(), B.end()), B.end());
+  ThreadPool pool;
+  vector<string> names = {"union", "intersection", "difference"};
+  for (int op = 0; op < 3; op++) {
+    double setTime, insertTime = 0, seqTime, parTime;
+    long long cs0, cs1 = 0, cs2, cs3;
+    {
+      set<int> SA(A.begin(), A.end()), SB(B.begin(), B.end()), SC;
+      auto start_time = chrono::system_clock::now();
+      auto out = inserter(SC, SC.end());
+      if (op == 0)
+        set_union(SA.begin(), SA.end(), SB.begin(), SB.end(), out);
+      else if (op == 1)
+        set_intersection(SA.begin(), SA.end(), SB.begin(), SB.end(), out);
+      else set_difference(SA.begin(), SA.end(), SB.begin(), SB.end(), out);
+      const auto end_time = chrono::system_clock::now();
+      setTime = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+      cs0 = checkSum(SC);
+    }
+    if (op == 0) {
+      Tree T; Node *a = build(T, A);
+      auto start_time = chrono::system_clock::now();
+      a = insertAll(T, a, B);
+      const auto end_time = chrono::system_clock::now();
+      insertTime = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+      cs1 = checkSum(T, a);
+    }
+    for (int t = 0; t < 2; t++) {
+      Tree T; Node *a = build(T, A), *b = build(T, B), *c;
+      less<int> cmp; auto start_time = chrono::system_clock::now();
+      if (op == 0) c = t ? T.setUnion(a, b, cmp, pool)
+                         : T.setUnion(a, b, cmp);
+      else if (op == 1) c = t ? T.setIntersection(a, b, cmp, pool)
+                              : T.setIntersection(a, b, cmp);
+      else c = t ? T.setDifference(a, b, cmp, pool)
+                 : T.setDifference(a, b, cmp);
+      const auto end_time = chrono::system_clock::now();
+      (t ? parTime : seqTime) = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+      (t ? cs3 : cs2) = checkSum(T, c);
+    }
+    assert(cs0 == cs2 && cs2 == cs3 && (op != 0 || cs1 == cs0));
+    cout << "Subtest " << op + 2 << " (" << names[op] << ") Passed" << endl;
+    cout << "  N: " << A.size() << ", " << B.size() << endl;
+    cout << "  std::set Time: " << fixed << setprecision(3) << setTime << "s"
+         << endl;
+    if (op == 0)
+      cout << "  Treap Insert Time: " << fixed << setprecision(3)
+           << insertTime << "s" << endl;
+    cout << "  Sequential Time: " << fixed << setprecision(3) << seqTime
+         << "s" << endl;
+    cout << "  Parallel Time (" << pool.size() << " threads): " << fixed
+         << setprecision(3) << parTime << "s" << endl;
+    cout << "  Checksum: " << cs0 << endl;
+  }
+}
+
+int main() {
+  test1();
+  test2();
+  cout << "Test Passed" << endl;
+  return 0;
+}
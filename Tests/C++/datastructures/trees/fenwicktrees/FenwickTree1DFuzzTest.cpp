@@ -1,7 +1,9 @@
 #include <bits/stdc++.h>
+#include "../../../../../Content/C++/datastructures/trees/fenwicktrees/BlockedFenwickTree1D.h"
 #include "../../../../../Content/C++/datastructures/trees/fenwicktrees/FenwickTree.h"
 #include "../../../../../Content/C++/datastructures/trees/fenwicktrees/FenwickTree1D.h"
 #include "../../../../../Content/C++/search/BinarySearch.h"
+#include "../../../../../Content/C++/utils/ThreadPool.h"
 using namespace std;
 
 void test1() {
@@ -130,9 +132,119 @@ void test2() {
   cout << "  Checksum: " << checkSum << endl;
 }
 
+void test3() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  ThreadPool pool(3);
+  const int TESTCASES = 1e4;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 101 + 1;
+    vector<long long> A(N);
+    for (auto &&ai : A) ai = rng() % int(1e9) + 1;
+    FenwickTree1D<long long> FT1(A.begin(), A.end()), FT2 = FT1;
+    int B = rng() % 10 + 1;
+    for (int b = 0; b < B; b++) {
+      int K = rng() % (N * 2 + 1);
+      vector<pair<int, long long>> U(K);
+      for (auto &&u : U) {
+        u = make_pair(int(rng() % N), rng() % int(1e9) + 1);
+        A[u.first] += u.second;
+        FT1.update(u.first, u.second);
+      }
+      FT2.applyUpdates(U);
+      int Q = rng() % 100;
+      vector<int> inds(Q);
+      for (auto &&i : inds) i = rng() % N;
+      vector<long long> ans0(Q), ans1(Q), ans2 = FT2.queryBatch(inds, pool);
+      for (int i = 0; i < Q; i++) {
+        for (int j = 0; j <= inds[i]; j++) ans0[i] += A[j];
+        ans1[i] = FT1.query(inds[i]);
+      }
+      assert(ans0 == ans1);
+      assert(ans0 == ans2);
+      assert(FT1.BIT == FT2.BIT);
+      for (auto &&a : ans0)
+        checkSum = (31 * checkSum + a) % (long long)(1e9 + 7);
+    }
+    assert(A == FT2.values());
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 3 (batch update, batch query) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+template <class T> void test4(int subtest, const string &name) {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1e4;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int maxVal = pow(10, rng() % 5);
+    int N = rng() % 3 == 0 ? rng() % 20 : rng() % 2000;
+    vector<T> A(N);
+    for (auto &&ai : A) ai = rng() % maxVal + 1;
+    BlockedFenwickTree1D<T> FT1(N);
+    BlockedFenwickTree1D<T> FT2(A.begin(), A.end());
+    for (int i = 0; i < N; i++) FT1.update(i, A[i]);
+    vector<T> P(N + 1, 0);
+    auto rebuild = [&] {
+      for (int i = 0; i < N; i++) P[i + 1] = P[i] + A[i];
+    };
+    rebuild();
+    int Q = N == 0 ? 0 : 100 - rng() % 5;
+    vector<T> ans0, ans1, ans2;
+    for (int i = 0; i < Q; i++) {
+      int t = rng() % 4;
+      if (t == 0) {
+        int i = rng() % N;
+        T v = rng() % maxVal + 1;
+        A[i] += v;
+        FT1.update(i, v);
+        FT2.update(i, v);
+        rebuild();
+      } else if (t == 1) {
+        int l = rng() % N, r = rng() % N;
+        if (l > r) swap(l, r);
+        ans0.push_back(P[r + 1] - P[l]);
+        ans1.push_back(FT1.query(l, r));
+        ans2.push_back(FT2.query(l, r));
+      } else if (t == 2) {
+        T v = rng() % (P[N] * 2 + 1);
+        ans0.push_back(std::lower_bound(P.begin() + 1, P.end(), v)
+                       - P.begin() - 1);
+        ans1.push_back(FT1.lower_bound(v));
+        ans2.push_back(FT2.lower_bound(v));
+      } else {
+        T v = rng() % (P[N] * 2 + 1);
+        ans0.push_back(std::upper_bound(P.begin() + 1, P.end(), v)
+                       - P.begin() - 1);
+        ans1.push_back(FT1.upper_bound(v));
+        ans2.push_back(FT2.upper_bound(v));
+      }
+    }
+    vector<T> A1 = FT1.values(), A2 = FT2.values();
+    assert(ans0 == ans1);
+    assert(ans0 == ans2);
+    assert(A == A1);
+    assert(A == A2);
+    for (auto &&a : ans0) checkSum = (31 * checkSum + a) % (long long)(1e9 + 7);
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
 int main() {
   test1();
   test2();
+  test3();
+  test4<long long>(4, "blocked, long long");
+  test4<int>(5, "blocked, int");
   cout << "Test Passed" << endl;
   return 0;
 }
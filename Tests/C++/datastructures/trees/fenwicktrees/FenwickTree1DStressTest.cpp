@@ -1,7 +1,9 @@
 #include <bits/stdc++.h>
+#include "../../../../../Content/C++/datastructures/trees/fenwicktrees/BlockedFenwickTree1D.h"
 #include "../../../../../Content/C++/datastructures/trees/fenwicktrees/FenwickTree.h"
 #include "../../../../../Content/C++/datastructures/trees/fenwicktrees/FenwickTree1D.h"
 #include "../../../../../Content/C++/search/BinarySearch.h"
+#include "../../../../../Content/C++/utils/ThreadPool.h"
 using namespace std;
 
 void test1() {
@@ -186,12 +188,155 @@ void test5() {
   cout << "  Checksum: " << checkSum << endl;
 }
 
+void test6() {
+  mt19937_64 rng(0);
+  int N = 1 << 22;
+  vector<long long> A(N);
+  for (auto &&ai : A) ai = rng() % int(1e9) + 1;
+  cout << "Subtest 6 (batch update crossover) Passed" << endl;
+  cout << "  N: " << N << endl;
+  long long checkSum = 0;
+  for (int div = 1024; div >= 1; div /= 4) {
+    int K = N / div;
+    vector<pair<int, long long>> U(K);
+    for (auto &&u : U) u = make_pair(int(rng() % N), rng() % int(1e9) + 1);
+    FenwickTree1D<long long> FT1(A.begin(), A.end()), FT2 = FT1;
+    FenwickTree1D<long long> FT3 = FT1, FT4 = FT1;
+    auto start_time = chrono::system_clock::now();
+    for (auto &&u : U) FT1.update(u.first, u.second);
+    auto end_time = chrono::system_clock::now();
+    double sec1 = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    start_time = chrono::system_clock::now();
+    vector<pair<int, long long>> S = U;
+    sort(S.begin(), S.end());
+    for (auto &&u : S) FT2.update(u.first, u.second);
+    end_time = chrono::system_clock::now();
+    double sec2 = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    start_time = chrono::system_clock::now();
+    vector<long long> B = FT3.values();
+    for (auto &&u : U) B[u.first] += u.second;
+    FT3 = FenwickTree1D<long long>(B.begin(), B.end());
+    end_time = chrono::system_clock::now();
+    double sec3 = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    start_time = chrono::system_clock::now();
+    FT4.applyUpdates(U);
+    end_time = chrono::system_clock::now();
+    double sec4 = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    assert(FT1.BIT == FT2.BIT);
+    assert(FT1.BIT == FT3.BIT);
+    assert(FT1.BIT == FT4.BIT);
+    cout << "  K: N / " << div << endl;
+    cout << "    Point Updates: " << fixed << setprecision(3) << sec1 << "s"
+         << endl;
+    cout << "    Sorted Updates: " << fixed << setprecision(3) << sec2 << "s"
+         << endl;
+    cout << "    Rebuild: " << fixed << setprecision(3) << sec3 << "s"
+         << endl;
+    cout << "    applyUpdates: " << fixed << setprecision(3) << sec4 << "s"
+         << endl;
+    checkSum = (31 * checkSum + FT4.query(N - 1)) % (long long)(1e9 + 7);
+  }
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test7() {
+  mt19937_64 rng(0);
+  int N = 1e7;
+  vector<long long> A(N);
+  for (auto &&ai : A) ai = rng() % int(1e9) + 1;
+  FenwickTree1D<long long> FT(A.begin(), A.end());
+  int Q = 1e7;
+  vector<int> inds(Q);
+  for (auto &&i : inds) i = rng() % N;
+  auto start_time = chrono::system_clock::now();
+  vector<long long> ans0(Q);
+  for (int i = 0; i < Q; i++) ans0[i] = FT.query(inds[i]);
+  auto end_time = chrono::system_clock::now();
+  double sec0 = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 7 (batch query) Passed" << endl;
+  cout << "  N: " << N << endl;
+  cout << "  Q: " << Q << endl;
+  cout << "  Sequential Time: " << fixed << setprecision(3) << sec0 << "s"
+       << endl;
+  for (int T = 1; T <= 4; T *= 2) {
+    ThreadPool pool(T);
+    start_time = chrono::system_clock::now();
+    vector<long long> ans1 = FT.queryBatch(inds, pool);
+    end_time = chrono::system_clock::now();
+    double sec1 = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    assert(ans0 == ans1);
+    cout << "  T: " << T << endl;
+    cout << "    Time: " << fixed << setprecision(3) << sec1 << "s" << endl;
+  }
+  long long checkSum = 0;
+  for (auto &&a : ans0) checkSum = (31 * checkSum + a) % (long long)(1e9 + 7);
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test8() {
+  mt19937_64 rng(0);
+  int Q = 1 << 21;
+  cout << "Subtest 8 (blocked layout latency) Passed" << endl;
+  cout << "  Q: " << Q << endl;
+  long long checkSum = 0;
+  for (int lgN = 20; lgN <= 26; lgN += 3) {
+    int N = 1 << lgN;
+    vector<long long> A(N);
+    for (auto &&ai : A) ai = rng() % int(1e9) + 1;
+    FenwickTree1D<long long> FT1(A.begin(), A.end());
+    BlockedFenwickTree1D<long long> FT2(A.begin(), A.end());
+    vector<int> inds(Q);
+    vector<long long> vals(Q), ans1(Q), ans2(Q);
+    for (auto &&i : inds) i = rng() % N;
+    for (auto &&v : vals) v = rng() % (long long)(1e18) + 1;
+    auto start_time = chrono::system_clock::now();
+    for (int i = 0; i < Q; i++) ans1[i] = FT1.query(inds[i]);
+    auto end_time = chrono::system_clock::now();
+    double sec1 = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    start_time = chrono::system_clock::now();
+    for (int i = 0; i < Q; i++) ans2[i] = FT2.query(inds[i]);
+    end_time = chrono::system_clock::now();
+    double sec2 = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    assert(ans1 == ans2);
+    start_time = chrono::system_clock::now();
+    for (int i = 0; i < Q; i++) FT1.update(inds[i], A[inds[Q - 1 - i]]);
+    end_time = chrono::system_clock::now();
+    double sec3 = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    start_time = chrono::system_clock::now();
+    for (int i = 0; i < Q; i++) FT2.update(inds[i], A[inds[Q - 1 - i]]);
+    end_time = chrono::system_clock::now();
+    double sec4 = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    start_time = chrono::system_clock::now();
+    for (int i = 0; i < Q; i++) ans1[i] = FT1.lower_bound(vals[i]);
+    end_time = chrono::system_clock::now();
+    double sec5 = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    start_time = chrono::system_clock::now();
+    for (int i = 0; i < Q; i++) ans2[i] = FT2.lower_bound(vals[i]);
+    end_time = chrono::system_clock::now();
+    double sec6 = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    assert(ans1 == ans2);
+    cout << "  N: 2^" << lgN << endl;
+    cout << "    FenwickTree1D query, update, lower_bound: " << fixed
+         << setprecision(1) << sec1 * 1e9 / Q << "ns, " << sec3 * 1e9 / Q
+         << "ns, " << sec5 * 1e9 / Q << "ns" << endl;
+    cout << "    BlockedFenwickTree1D query, update, lower_bound: " << fixed
+         << setprecision(1) << sec2 * 1e9 / Q << "ns, " << sec4 * 1e9 / Q
+         << "ns, " << sec6 * 1e9 / Q << "ns" << endl;
+    for (auto &&a : ans2)
+      checkSum = (31 * checkSum + a) % (long long)(1e9 + 7);
+  }
+  cout << "  Checksum: " << checkSum << endl;
+}
+
 int main() {
   test1();
   test2();
   test3();
   test4();
   test5();
+  test6();
+  test7();
+  test8();
   cout << "Test Passed" << endl;
   return 0;
 }
@@ -0,0 +1,103 @@
+#include <bits/stdc++.h>
+#include "../../../../../Content/C++/datastructures/trees/segmenttrees/SegmentTreesTopDown.h"
+using namespace std;
+
+struct AddSum {
+  using Data = long long;
+  using Lazy = long long;
+  const Data qdef = 0;
+  const Lazy ldef = 0;
+  Data merge(const Data &l, const Data &r) const { return l + r; }
+  Data applyLazy(const Data &l, const Lazy &r) const { return l + r; }
+  template <class IndexType> Lazy getSegmentVal(const Lazy &v,
+                                                IndexType k) const {
+    return v * k;
+  }
+  Lazy mergeLazy(const Lazy &l, const Lazy &r) const { return l + r; }
+  template <class IndexType> Data getSegmentVdef(IndexType k) const {
+    return k;
+  }
+};
+
+template <class Tree>
+void update(Tree &ST, int l, int, long long v, bool newRoot, false_type) {
+  ST.update(l, v, newRoot);
+}
+
+template <class Tree>
+void update(Tree &ST, int l, int r, long long v, bool newRoot, true_type) {
+  ST.update(l, r, v, newRoot);
+}
+
+template <const bool LAZY, const bool PERSISTENT>
+void test(int subtest, const string &name) {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1e4;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 100 + 1;
+    vector<long long> A(N, 1);
+    bool sparse = rng() % 2;
+    if (!sparse) for (auto &&a : A) a = rng() % int(1e9);
+    using Tree = DynamicSegmentTree<int, LAZY, PERSISTENT, AddSum>;
+    Tree ST = sparse ? Tree(N) : Tree(A.begin(), A.end());
+    vector<vector<long long>> history(1, A);
+    int Q = 100, mark = -1, markRoots = -1;
+    vector<long long> ans0, ans1;
+    for (int i = 0; i < Q; i++) {
+      int t = rng() % 4;
+      if (t == 0) {
+        int l = rng() % N, r = LAZY ? rng() % N : l;
+        if (l > r) swap(l, r);
+        long long v = rng() % int(1e9);
+        bool newRoot = PERSISTENT && rng() % 2;
+        update(ST, l, r, v, newRoot, integral_constant<bool, LAZY>());
+        vector<long long> B = history.back();
+        for (int j = l; j <= r; j++) B[j] += v;
+        if (newRoot) history.push_back(B);
+        else history.back() = B;
+      } else if (t == 1 && PERSISTENT) {
+        int k = rng() % history.size();
+        ST.revert(k);
+        history.push_back(history[k]);
+      } else if (t == 2 && PERSISTENT && !LAZY) {
+        if (markRoots == -1) {
+          mark = ST.TR.mark();
+          markRoots = history.size();
+          ST.revert(markRoots - 1);
+          history.push_back(history.back());
+        } else {
+          ST.TR.rewind(mark);
+          ST.roots.resize(markRoots);
+          history.resize(markRoots);
+          markRoots = -1;
+        }
+      } else {
+        int k = PERSISTENT ? rng() % history.size() : history.size() - 1;
+        int l = rng() % N, r = rng() % N;
+        if (l > r) swap(l, r);
+        long long sm = 0;
+        for (int j = l; j <= r; j++) sm += history[k][j];
+        ans0.push_back(sm);
+        ans1.push_back(ST.query(l, r, k));
+      }
+    }
+    assert(ans0 == ans1);
+    for (auto &&a : ans0) checkSum = (31 * checkSum + a) % (long long)(1e9 + 7);
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test<false, false>(1, "point update, not persistent");
+  test<false, true>(2, "point update, persistent, rewind");
+  test<true, false>(3, "range update, not persistent");
+  test<true, true>(4, "range update, persistent");
+  cout << "Test Passed" << endl;
+  return 0;
+}
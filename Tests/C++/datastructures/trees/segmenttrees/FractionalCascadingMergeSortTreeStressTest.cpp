@@ -0,0 +1,148 @@
+#include <bits/stdc++.h>
+#include "../../../../../Content/C++/datastructures/trees/segmenttrees/FractionalCascadingMergeSortTree.h"
+#include "../../../../../Content/C++/datastructures/trees/segmenttrees/MergeSortTree.h"
+using namespace std;
+
+template <class Comparator>
+void test(int subtest, const string &name, ThreadPool *pool) {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1e4;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % (ti < 20 ? 100000 : 100) + 1;
+    int V = rng() % 2 ? 5 : int(1e9);
+    vector<int> A(N);
+    for (auto &&a : A) a = rng() % V;
+    using FCMST = FractionalCascadingMergeSortTree<int, Comparator>;
+    FCMST FC = pool ? FCMST(A.begin(), A.end(), *pool)
+                    : FCMST(A.begin(), A.end());
+    MergeSortTree<int, Comparator> MST(A.begin(), A.end());
+    int Q = 100;
+    vector<long long> ans0, ans1;
+    for (int i = 0; i < Q; i++) {
+      int t = rng() % 3, l = rng() % N, r = rng() % N;
+      if (l > r) swap(l, r);
+      if (t == 0) {
+        int k = rng() % (r - l + 1);
+        ans0.push_back(MST.select(l, r, k));
+        ans1.push_back(FC.select(l, r, k));
+      } else if (t == 1) {
+        int v = rng() % 2 ? A[rng() % N] : int(rng() % V);
+        ans0.push_back(MST.rank(l, r, v));
+        ans1.push_back(FC.rank(l, r, v));
+      } else {
+        int lo = rng() % V, hi = rng() % V;
+        if (rng() % 4 && Comparator()(hi, lo)) swap(lo, hi);
+        int c = 0;
+        for (int j = l; j <= r; j++)
+          c += !Comparator()(A[j], lo) && !Comparator()(hi, A[j]);
+        ans0.push_back(c);
+        ans1.push_back(FC.count(l, r, lo, hi));
+      }
+    }
+    assert(ans0 == ans1);
+    for (auto &&a : ans0) checkSum = (31 * checkSum + a) % (long long)(1e9 + 7);
+  }
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+template <class DS>
+void bench(const string &name, DS &ds, const vector<array<int, 3>> &sel,
+           const vector<array<int, 3>> &rnk, const vector<int> &A,
+           long long &checkSum) {
+  auto start_time = chrono::system_clock::now();
+  long long sel0 = 0, rnk0 = 0;
+  for (auto &&q : sel) sel0 += ds.select(q[0], q[1], q[2]);
+  auto end_time = chrono::system_clock::now();
+  double st = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  start_time = chrono::system_clock::now();
+  for (auto &&q : rnk) rnk0 += ds.rank(q[0], q[1], A[q[0] + q[2]]);
+  end_time = chrono::system_clock::now();
+  double rt = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "  " << name << " select: " << fixed << setprecision(0)
+       << st * 1e9 / sel.size() << "ns per query" << endl;
+  cout << "  " << name << " rank: " << fixed << setprecision(0)
+       << rt * 1e9 / rnk.size() << "ns per query" << endl;
+  checkSum = (31 * checkSum + sel0 % int(1e9 + 7)) % (long long)(1e9 + 7);
+  checkSum = (31 * checkSum + rnk0 % int(1e9 + 7)) % (long long)(1e9 + 7);
+}
+
+void test4() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  int N = 1e7, Q = 1e5;
+  vector<int> A(N);
+  for (auto &&a : A) a = rng() % int(1e9);
+  vector<array<int, 3>> sel(Q), rnk(Q);
+  for (auto &&q : sel) {
+    int l = rng() % N, r = rng() % N;
+    if (l > r) swap(l, r);
+    q = array<int, 3>{l, r, int(rng() % (r - l + 1))};
+  }
+  for (auto &&q : rnk) {
+    int l = rng() % N, r = rng() % N;
+    if (l > r) swap(l, r);
+    q = array<int, 3>{l, r, int(rng() % (r - l + 1))};
+  }
+  vector<array<int, 3>> selMST(sel.begin(), sel.begin() + Q / 50);
+  long long checkSum0 = 0, checkSum1 = 0, checkSum2 = 0;
+  {
+    auto build_time = chrono::system_clock::now();
+    FractionalCascadingMergeSortTree<int> FC(A.begin(), A.end());
+    auto end_time = chrono::system_clock::now();
+    double sec = ((end_time - build_time).count() / double(chrono::system_clock::period::den));
+    cout << "  Fractional Cascading Merge Sort Tree build: " << fixed
+         << setprecision(3) << sec << "s" << endl;
+    size_t mem = (FC.sorted.capacity() + FC.rnk.capacity()) * sizeof(int);
+    for (auto &&b : FC.B) mem += b.B.capacity() * sizeof(BitVector::Block);
+    cout << "  Fractional Cascading Merge Sort Tree memory: " << fixed
+         << setprecision(2) << double(mem) / N << " bytes per element"
+         << endl;
+    bench("Fractional Cascading Merge Sort Tree", FC, sel, rnk, A,
+          checkSum0);
+    bench("Fractional Cascading Merge Sort Tree", FC, selMST, rnk, A,
+          checkSum1);
+    ThreadPool pool;
+    build_time = chrono::system_clock::now();
+    FractionalCascadingMergeSortTree<int> FC2(A.begin(), A.end(), pool);
+    end_time = chrono::system_clock::now();
+    sec = ((end_time - build_time).count() / double(chrono::system_clock::period::den));
+    cout << "  Parallel build (" << pool.size() << " threads): " << fixed
+         << setprecision(3) << sec << "s" << endl;
+    assert(FC.sorted == FC2.sorted);
+  }
+  {
+    auto build_time = chrono::system_clock::now();
+    MergeSortTree<int> MST(A.begin(), A.end());
+    auto end_time = chrono::system_clock::now();
+    double sec = ((end_time - build_time).count() / double(chrono::system_clock::period::den));
+    cout << "  Merge Sort Tree build: " << fixed << setprecision(3)
+         << sec << "s" << endl;
+    size_t mem = (MST.sorted.capacity() + MST.TR.capacity() * 6)
+        * sizeof(int);
+    for (auto &&t : MST.TR) mem += t.capacity() * sizeof(int);
+    cout << "  Merge Sort Tree memory: " << fixed << setprecision(2)
+         << double(mem) / N << " bytes per element" << endl;
+    bench("Merge Sort Tree", MST, selMST, rnk, A, checkSum2);
+  }
+  assert(checkSum1 == checkSum2);
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum0 << endl;
+}
+
+int main() {
+  ThreadPool pool(4);
+  test<less<int>>(1, "less", nullptr);
+  test<greater<int>>(2, "greater", nullptr);
+  test<less<int>>(3, "less, parallel build", &pool);
+  test4();
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <bits/stdc++.h>
+using namespace std;
+
+// Combine structs shared by the SegmentTreeBottomUp tests, where W selects
+//   the wide tree
+
+template <class T, const bool W> struct SumCombine {
+  using Data = T;
+  using Lazy = T;
+  static const bool WIDE = W;
+  const Data qdef = 0;
+  Data merge(const Data &l, const Data &r) const { return l + r; }
+  Data applyLazy(const Data &l, const Lazy &r) const { return l + r; }
+};
+
+template <class T, const bool W> struct MinCombine {
+  using Data = T;
+  using Lazy = T;
+  static const bool WIDE = W;
+  const Data qdef = numeric_limits<T>::max();
+  Data merge(const Data &l, const Data &r) const { return min(l, r); }
+  Data applyLazy(const Data &, const Lazy &r) const { return r; }
+};
+
+template <class T, const bool W> struct MaxCombine {
+  using Data = T;
+  using Lazy = T;
+  static const bool WIDE = W;
+  const Data qdef = numeric_limits<T>::lowest();
+  Data merge(const Data &l, const Data &r) const { return max(l, r); }
+  Data applyLazy(const Data &l, const Lazy &r) const { return l + r; }
+};
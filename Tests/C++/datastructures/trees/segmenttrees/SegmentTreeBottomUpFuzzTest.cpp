@@ -0,0 +1,78 @@
+#include <bits/stdc++.h>
+#include "../../../../../Content/C++/datastructures/trees/segmenttrees/SegmentTreesBottomUp.h"
+#include "SegmentTreeBottomUpCombines.h"
+using namespace std;
+
+template <class Wide, class Scalar>
+void test(int subtest, const string &name) {
+  static_assert(IsWideCombine<Wide>::value, "Wide must be wide");
+  static_assert(!IsWideCombine<Scalar>::value, "Scalar must not be wide");
+  using T = typename Wide::Data;
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1e4;
+  Wide C;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 4 == 0 ? rng() % 5000 : rng() % 300;
+    vector<T> A(N);
+    for (auto &&ai : A) ai = T(rng() % 1000) - 500;
+    SegmentTreeBottomUp<Wide> ST1(A.begin(), A.end());
+    SegmentTreeBottomUp<Scalar> ST2(A.begin(), A.end());
+    SegmentTreeBottomUp<Wide> ST3(N, T(3));
+    vector<T> B(N, T(3));
+    int Q = N == 0 ? 0 : 100 - rng() % 5;
+    vector<T> ans0, ans1, ans2, ans3;
+    for (int i = 0; i < Q; i++) {
+      int t = rng() % 2;
+      if (t == 0) {
+        int i = rng() % N;
+        T v = T(rng() % 1000) - 500;
+        A[i] = C.applyLazy(A[i], v);
+        B[i] = C.applyLazy(B[i], v);
+        ST1.update(i, v);
+        ST2.update(i, v);
+        ST3.update(i, v);
+      } else {
+        int l = rng() % N, r = rng() % N;
+        if (rng() % 4 == 0) r = min(N - 1, l + int(rng() % 40));
+        if (l > r) swap(l, r);
+        T a = C.qdef, b = C.qdef;
+        for (int j = l; j <= r; j++) {
+          a = C.merge(a, A[j]);
+          b = C.merge(b, B[j]);
+        }
+        ans0.push_back(a);
+        ans1.push_back(ST1.query(l, r));
+        ans2.push_back(ST2.query(l, r));
+        ans0.push_back(b);
+        ans1.push_back(ST3.query(l, r));
+        ans2.push_back(b);
+      }
+    }
+    assert(ans0 == ans1);
+    assert(ans0 == ans2);
+    for (auto &&a : ans0)
+      checkSum = (31 * checkSum + (long long)a) % (long long)(1e9 + 7);
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test<SumCombine<int, true>, SumCombine<int, false>>(1, "sum, int");
+  test<SumCombine<long long, true>, SumCombine<long long, false>>(
+      2, "sum, long long");
+  test<SumCombine<float, true>, SumCombine<float, false>>(3, "sum, float");
+  test<MinCombine<int, true>, MinCombine<int, false>>(4, "min, int");
+  test<MinCombine<long long, true>, MinCombine<long long, false>>(
+      5, "min, long long");
+  test<MaxCombine<int, true>, MaxCombine<int, false>>(6, "max, int");
+  test<MaxCombine<double, true>, MaxCombine<double, false>>(
+      7, "max, double");
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,67 @@
+#include <bits/stdc++.h>
+#include "../../../../../Content/C++/datastructures/trees/segmenttrees/SegmentTreesBottomUp.h"
+#include "SegmentTreeBottomUpCombines.h"
+using namespace std;
+
+template <class Combine>
+pair<double, double> run(const vector<typename Combine::Data> &A,
+                         const vector<pair<int, int>> &queries,
+                         vector<typename Combine::Data> &ans) {
+  SegmentTreeBottomUp<Combine> ST(A.begin(), A.end());
+  int N = A.size(), Q = queries.size();
+  auto start_time = chrono::system_clock::now();
+  for (int i = 0; i < Q; i++)
+    ST.update(queries[i].first, A[queries[i].second]);
+  auto end_time = chrono::system_clock::now();
+  double updateSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  start_time = chrono::system_clock::now();
+  for (int i = 0; i < Q; i++) {
+    int l = queries[i].first, r = queries[i].second;
+    if (l > r) swap(l, r);
+    ans[i] = ST.query(l, r);
+  }
+  end_time = chrono::system_clock::now();
+  double querySec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  ans.push_back(ST.query(0, N - 1));
+  return make_pair(updateSec, querySec);
+}
+
+template <class Wide, class Scalar>
+void test(int subtest, const string &name) {
+  using T = typename Wide::Data;
+  mt19937_64 rng(0);
+  int N = 1 << 22, Q = 5e6;
+  vector<T> A(N);
+  for (auto &&ai : A) ai = T(rng() % 100);
+  vector<pair<int, int>> queries(Q);
+  for (auto &&q : queries) q = make_pair(int(rng() % N), int(rng() % N));
+  vector<T> ans1(Q), ans2(Q);
+  pair<double, double> t1 = run<Wide>(A, queries, ans1);
+  pair<double, double> t2 = run<Scalar>(A, queries, ans2);
+  assert(ans1 == ans2);
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  N: " << N << endl;
+  cout << "  Q: " << Q << endl;
+  cout << "  Wide Update Throughput: " << fixed << setprecision(3)
+       << Q / t1.first / 1e6 << "M/s" << endl;
+  cout << "  Scalar Update Throughput: " << fixed << setprecision(3)
+       << Q / t2.first / 1e6 << "M/s" << endl;
+  cout << "  Wide Query Throughput: " << fixed << setprecision(3)
+       << Q / t1.second / 1e6 << "M/s" << endl;
+  cout << "  Scalar Query Throughput: " << fixed << setprecision(3)
+       << Q / t2.second / 1e6 << "M/s" << endl;
+  long long checkSum = 0;
+  for (auto &&a : ans1)
+    checkSum = (31 * checkSum + (long long)a) % (long long)(1e9 + 7);
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test<SumCombine<int, true>, SumCombine<int, false>>(1, "sum, int");
+  test<SumCombine<long long, true>, SumCombine<long long, false>>(
+      2, "sum, long long");
+  test<MinCombine<int, true>, MinCombine<int, false>>(3, "min, int");
+  test<MaxCombine<float, true>, MaxCombine<float, false>>(4, "max, float");
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,131 @@
+#include <bits/stdc++.h>
+#include "../../../../../Content/C++/datastructures/trees/segmenttrees/SnapshotSegmentTree.h"
+using namespace std;
+
+const long long MOD = 998244353;
+
+struct AssignSum {
+  using Data = long long;
+  using Lazy = long long;
+  const Data qdef = 0;
+  const Lazy ldef = numeric_limits<long long>::min();
+  Data merge(const Data &l, const Data &r) const { return l + r; }
+  Data applyLazy(const Data &, const Lazy &r) const { return r; }
+  Lazy getSegmentVal(const Lazy &v, int k) const { return v * k; }
+  Lazy mergeLazy(const Lazy &, const Lazy &r) const { return r; }
+  Lazy randomLazy(mt19937_64 &rng) const { return rng() % int(1e9); }
+  Data applyNaive(const Data &, const Lazy &v) const { return v; }
+};
+
+struct AddMin {
+  using Data = long long;
+  using Lazy = long long;
+  const Data qdef = numeric_limits<long long>::max();
+  const Lazy ldef = 0;
+  Data merge(const Data &l, const Data &r) const { return min(l, r); }
+  Data applyLazy(const Data &l, const Lazy &r) const { return l + r; }
+  Lazy getSegmentVal(const Lazy &v, int) const { return v; }
+  Lazy mergeLazy(const Lazy &l, const Lazy &r) const { return l + r; }
+  Lazy randomLazy(mt19937_64 &rng) const {
+    return (long long)(rng() % int(1e9)) - int(5e8);
+  }
+  Data applyNaive(const Data &l, const Lazy &v) const { return l + v; }
+};
+
+struct AffineSum {
+  using Data = long long;
+  using Lazy = pair<long long, long long>;
+  const Data qdef = 0;
+  const Lazy ldef = make_pair(1, 0);
+  Data merge(const Data &l, const Data &r) const { return (l + r) % MOD; }
+  Data applyLazy(const Data &l, const Lazy &r) const {
+    return (r.first * l + r.second) % MOD;
+  }
+  Lazy getSegmentVal(const Lazy &v, int k) const {
+    return make_pair(v.first, v.second * k % MOD);
+  }
+  Lazy mergeLazy(const Lazy &l, const Lazy &r) const {
+    return make_pair(r.first * l.first % MOD,
+                     (r.first * l.second + r.second) % MOD);
+  }
+  Lazy randomLazy(mt19937_64 &rng) const {
+    return make_pair(rng() % MOD, rng() % MOD);
+  }
+  Data applyNaive(const Data &l, const Lazy &v) const {
+    return (v.first * l + v.second) % MOD;
+  }
+};
+
+template <class Combine> void test(int subtest, const string &name) {
+  using Tree = SnapshotSegmentTree<Combine>;
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 3e3;
+  Combine C;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 100 + 1, R = rng() % 5 + 1;
+    vector<long long> A(N);
+    for (auto &&ai : A) ai = rng() % MOD;
+    Tree ST(A.begin(), A.end(), R);
+    vector<unique_ptr<typename Tree::Snapshot>> snaps(R);
+    map<long long, vector<long long>> history;
+    history[0] = A;
+    long long ver = 0;
+    int Q = 200;
+    vector<long long> ans0, ans1;
+    for (int i = 0; i < Q; i++) {
+      int t = rng() % 4;
+      if (t == 0) {
+        int l = rng() % N, r = rng() % N;
+        if (l > r) swap(l, r);
+        typename Combine::Lazy v = C.randomLazy(rng);
+        for (int j = l; j <= r; j++) A[j] = C.applyNaive(A[j], v);
+        ST.update(l, r, v);
+        history[++ver] = A;
+      } else if (t == 1) {
+        int k = rng() % R;
+        snaps[k].reset();
+        snaps[k].reset(new typename Tree::Snapshot(ST.snapshot(k)));
+        assert(snaps[k]->version() == ver);
+      } else if (t == 2) {
+        int k = rng() % R;
+        if (rng() % 4 == 0) snaps[k].reset();
+        int l = rng() % N, r = rng() % N;
+        if (l > r) swap(l, r);
+        const vector<long long> &B = snaps[k] ? history[snaps[k]->version()]
+                                              : A;
+        long long a = C.qdef;
+        for (int j = l; j <= r; j++) a = C.merge(a, B[j]);
+        ans0.push_back(a);
+        ans1.push_back(snaps[k] ? snaps[k]->query(l, r) : ST.query(l, r));
+      } else {
+        int l = rng() % N, r = rng() % N;
+        if (l > r) swap(l, r);
+        long long a = C.qdef;
+        for (int j = l; j <= r; j++) a = C.merge(a, A[j]);
+        ans0.push_back(a);
+        ans1.push_back(ST.query(l, r));
+      }
+    }
+    assert(ans0 == ans1);
+    for (auto &&s : snaps) s.reset();
+    ST.reclaim();
+    assert(ST.cnt - int(ST.freeNodes.size()) == N * 2 - 1);
+    for (auto &&a : ans0)
+      checkSum = (31 * checkSum + a % MOD + MOD) % (long long)(1e9 + 7);
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test<AssignSum>(1, "range assignment, range sum");
+  test<AddMin>(2, "range add, range min");
+  test<AffineSum>(3, "range affine, range sum");
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,132 @@
+#include <bits/stdc++.h>
+#include "../../../../../Content/C++/datastructures/trees/segmenttrees/SegmentTreesTopDown.h"
+#include "../../../../../Content/C++/datastructures/trees/segmenttrees/SnapshotSegmentTree.h"
+using namespace std;
+
+struct Combine {
+  using Data = long long;
+  using Lazy = long long;
+  const Data qdef = 0;
+  const Lazy ldef = 0;
+  Data merge(const Data &l, const Data &r) const { return l + r; }
+  Data applyLazy(const Data &l, const Lazy &r) const { return l + r; }
+  Lazy getSegmentVal(const Lazy &v, int k) const { return v * k; }
+  Lazy mergeLazy(const Lazy &l, const Lazy &r) const { return l + r; }
+};
+
+void printLatencies(vector<vector<long long>> &lat) {
+  vector<long long> all;
+  for (auto &&l : lat) all.insert(all.end(), l.begin(), l.end());
+  sort(all.begin(), all.end());
+  cout << "  Reads: " << all.size() << endl;
+  vector<pair<string, double>> percentiles = {
+    {"p50", 0.5}, {"p90", 0.9}, {"p99", 0.99}, {"p99.9", 0.999}
+  };
+  for (auto &&p : percentiles) {
+    long long v = all[min(all.size() - 1, size_t(p.second * all.size()))];
+    cout << "  " << p.first << " Read Latency: " << v << "ns" << endl;
+  }
+  cout << "  Max Read Latency: " << all.back() << "ns" << endl;
+}
+
+template <class Read, class Write>
+void runReadersAndWriter(int R, Read read, Write write,
+                         vector<vector<long long>> &lat) {
+  atomic<bool> done(false);
+  vector<thread> readers;
+  for (int k = 0; k < R; k++) readers.emplace_back([&, k] {
+    mt19937_64 rng(k + 1);
+    while (!done.load()) {
+      auto st = chrono::steady_clock::now();
+      read(k, rng);
+      auto en = chrono::steady_clock::now();
+      lat[k].push_back(chrono::duration_cast<chrono::nanoseconds>(en - st)
+                           .count());
+    }
+  });
+  write();
+  done = true;
+  for (auto &&t : readers) t.join();
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  int N = 1 << 20, U = 2e5, R = 3;
+  mt19937_64 rng(0);
+  vector<long long> A(N);
+  for (auto &&ai : A) ai = rng() % int(1e9);
+  vector<long long> total(U + 1, 0);
+  for (auto &&ai : A) total[0] += ai;
+  SnapshotSegmentTree<Combine> ST(A.begin(), A.end(), R);
+  vector<vector<long long>> lat(R);
+  runReadersAndWriter(R, [&] (int k, mt19937_64 &rng) {
+    auto snap = ST.snapshot(k);
+    int m = rng() % N;
+    long long a = snap.query(0, m), b = m + 1 < N ? snap.query(m + 1, N - 1)
+                                                  : 0;
+    assert(a + b == total[snap.version()]);
+  }, [&] {
+    for (int i = 0; i < U; i++) {
+      int l = rng() % N, r = rng() % N;
+      if (l > r) swap(l, r);
+      long long v = rng() % 1000;
+      total[i + 1] = total[i] + v * (r - l + 1);
+      ST.update(l, r, v);
+    }
+  }, lat);
+  assert(ST.query(0, N - 1) == total[U]);
+  cout << "Subtest 1 (snapshot readers, single writer) Passed" << endl;
+  cout << "  N: " << N << endl;
+  cout << "  U: " << U << endl;
+  cout << "  R: " << R << endl;
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  printLatencies(lat);
+  cout << "  Live Nodes: " << ST.cnt - int(ST.freeNodes.size()) << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  int N = 1 << 20, U = 2e5, R = 3;
+  mt19937_64 rng(0);
+  vector<long long> A(N);
+  for (auto &&ai : A) ai = rng() % int(1e9);
+  long long total = 0;
+  for (auto &&ai : A) total += ai;
+  SegmentTreeTopDown<true, Combine> ST(A.begin(), A.end());
+  mutex m;
+  vector<vector<long long>> lat(R);
+  runReadersAndWriter(R, [&] (int, mt19937_64 &rng) {
+    lock_guard<mutex> lock(m);
+    int mid = rng() % N;
+    long long a = ST.query(0, mid), b = mid + 1 < N ? ST.query(mid + 1, N - 1)
+                                                    : 0;
+    assert(a + b == total);
+  }, [&] {
+    for (int i = 0; i < U; i++) {
+      int l = rng() % N, r = rng() % N;
+      if (l > r) swap(l, r);
+      long long v = rng() % 1000;
+      lock_guard<mutex> lock(m);
+      total += v * (r - l + 1);
+      ST.update(l, r, v);
+    }
+  }, lat);
+  cout << "Subtest 2 (global lock readers, single writer) Passed" << endl;
+  cout << "  N: " << N << endl;
+  cout << "  U: " << U << endl;
+  cout << "  R: " << R << endl;
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  printLatencies(lat);
+  cout << "  Checksum: " << total % (long long)(1e9 + 7) << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,135 @@
+#include <bits/stdc++.h>
+#include "../../../../../Content/C++/datastructures/trees/segmenttrees/WaveletMatrix.h"
+#include "../../../../../Content/C++/datastructures/trees/segmenttrees/WaveletTree.h"
+using namespace std;
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1e4;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 100 + 1;
+    vector<int> A(N);
+    for (auto &&a : A) a = rng() % 257;
+    BitVector BV(N);
+    vector<int> pre(N + 1, 0), ones, zeros;
+    for (int i = 0; i < N; i++) {
+      if (A[i] & 1) { BV.set(i); ones.push_back(i); }
+      else zeros.push_back(i);
+      pre[i + 1] = pre[i] + (A[i] & 1);
+    }
+    BV.build();
+    for (int i = 0; i <= N; i++) {
+      assert(BV.rank1(i) == pre[i]);
+      assert(BV.rank0(i) == i - pre[i]);
+      if (i < N) assert(BV.get(i) == bool(A[i] & 1));
+    }
+    for (int k = 0; k <= N; k++) {
+      assert(BV.select1(k) == (k < int(ones.size()) ? ones[k] : N));
+      assert(BV.select0(k) == (k < int(zeros.size()) ? zeros[k] : N));
+    }
+    checkSum = (31 * checkSum + pre[N]) % (long long)(1e9 + 7);
+  }
+  for (int ti = 0; ti < 10; ti++) {
+    int N = rng() % 100000 + 1;
+    BitVector BV(N);
+    vector<int> pre(N + 1, 0), ones, zeros;
+    for (int i = 0; i < N; i++) {
+      if (rng() % 8 == 0) { BV.set(i); ones.push_back(i); }
+      else zeros.push_back(i);
+      pre[i + 1] = ones.size();
+    }
+    BV.build();
+    for (int i = 0; i <= N; i++) assert(BV.rank1(i) == pre[i]);
+    for (int k = 0; k < int(ones.size()); k++)
+      assert(BV.select1(k) == ones[k]);
+    for (int k = 0; k < int(zeros.size()); k++)
+      assert(BV.select0(k) == zeros[k]);
+    checkSum = (31 * checkSum + pre[N]) % (long long)(1e9 + 7);
+  }
+  cout << "Subtest 1 (bit vector) Passed" << endl;
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+template <class Comparator> void test(int subtest, const string &name) {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1e4;
+  long long checkSum = 0;
+  Comparator cmp;
+  auto ptr = [&] (const int *p) { return p ? *p : -1; };
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 100 + 1, V = rng() % 2 ? 5 : int(1e9);
+    vector<int> A(N);
+    for (auto &&a : A) a = rng() % V;
+    WaveletMatrix<int, Comparator> WM(A.begin(), A.end());
+    WaveletTree<int, Comparator> WT(A.begin(), A.end());
+    int Q = 100;
+    vector<long long> ans0, ans1;
+    for (int i = 0; i < Q; i++) {
+      int t = rng() % 7, l = rng() % N, r = rng() % N;
+      if (l > r) swap(l, r);
+      vector<int> B(A.begin() + l, A.begin() + r + 1);
+      sort(B.begin(), B.end(), cmp);
+      int v = rng() % 2 ? A[rng() % N] : int(rng() % V);
+      if (t == 0) {
+        int k = rng() % (r - l + 1);
+        ans0.push_back(B[k]);
+        ans1.push_back(WM.select(l, r, k));
+        assert(WT.select(l, r, k) == B[k]);
+      } else if (t == 1) {
+        int c = lower_bound(B.begin(), B.end(), v, cmp) - B.begin();
+        ans0.push_back(c);
+        ans1.push_back(WM.rank(l, r, v));
+        assert(WT.rank(l, r, v) == c);
+      } else if (t == 2) {
+        int lo = rng() % V, hi = rng() % V;
+        if (cmp(hi, lo)) swap(lo, hi);
+        int c = upper_bound(B.begin(), B.end(), hi, cmp)
+            - lower_bound(B.begin(), B.end(), lo, cmp);
+        ans0.push_back(c);
+        ans1.push_back(WM.count(l, r, lo, hi));
+        assert(WT.count(l, r, lo, hi) == c);
+      } else if (t == 3) {
+        auto lb = lower_bound(B.begin(), B.end(), v, cmp);
+        auto ub = upper_bound(B.begin(), B.end(), v, cmp);
+        ans0.push_back(lb == B.begin() ? -1 : *prev(lb));
+        ans0.push_back(ub == B.begin() ? -1 : *prev(ub));
+        ans0.push_back(lb == B.end() ? -1 : *lb);
+        ans0.push_back(ub == B.end() ? -1 : *ub);
+        ans1.push_back(ptr(WM.below(l, r, v)));
+        ans1.push_back(ptr(WM.floor(l, r, v)));
+        ans1.push_back(ptr(WM.ceiling(l, r, v)));
+        ans1.push_back(ptr(WM.above(l, r, v)));
+      } else if (t == 4) {
+        ans0.push_back(A[l]);
+        ans1.push_back(WM.at(l));
+      } else {
+        int k = int(rng() % 4) - 1, j = -1;
+        for (int x = 0, c = 0; x < N && k >= 0; x++)
+          if (!cmp(A[x], v) && !cmp(v, A[x]) && c++ == k) { j = x; break; }
+        ans0.push_back(j);
+        ans1.push_back(WM.indexOf(v, k));
+      }
+    }
+    assert(ans0 == ans1);
+    for (auto &&a : ans0) checkSum = (31 * checkSum + a) % (long long)(1e9 + 7);
+  }
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test<less<int>>(2, "less");
+  test<greater<int>>(3, "greater");
+  cout << "Test Passed" << endl;
+  return 0;
+}
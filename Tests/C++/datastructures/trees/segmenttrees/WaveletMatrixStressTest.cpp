@@ -0,0 +1,119 @@
+#include <bits/stdc++.h>
+#include "../../../../../Content/C++/datastructures/trees/segmenttrees/MergeSortTree.h"
+#include "../../../../../Content/C++/datastructures/trees/segmenttrees/WaveletMatrix.h"
+#include "../../../../../Content/C++/datastructures/trees/segmenttrees/WaveletTree.h"
+using namespace std;
+
+template <class T> size_t bytes(const vector<T> &v) {
+  return v.capacity() * sizeof(T);
+}
+
+size_t bytes(const WaveletMatrix<int> &WM) {
+  size_t ret = bytes(WM.vals) + bytes(WM.Z);
+  for (auto &&b : WM.B) ret += bytes(b.B);
+  return ret;
+}
+
+size_t bytes(const WaveletTree<int> &WT) {
+  return bytes(WT.ind) + bytes(WT.rnk) + bytes(WT.roots) + bytes(WT.A)
+      + bytes(WT.TR);
+}
+
+size_t bytes(const MergeSortTree<int> &MST) {
+  size_t ret = bytes(MST.sorted) + bytes(MST.TR);
+  for (auto &&t : MST.TR) ret += bytes(t);
+  return ret;
+}
+
+vector<array<int, 3>> queries(int N, int Q, mt19937_64 &rng) {
+  vector<array<int, 3>> ret(Q);
+  for (auto &&q : ret) {
+    int l = rng() % N, r = rng() % N;
+    if (l > r) swap(l, r);
+    q = array<int, 3>{l, r, int(rng() % (r - l + 1))};
+  }
+  return ret;
+}
+
+template <class DS>
+void bench(const string &name, int N, DS &ds, size_t mem,
+           const vector<array<int, 3>> &sel, const vector<array<int, 3>> &rnk,
+           const vector<int> &A, long long &checkSum) {
+  cout << "  " << name << ": " << fixed << setprecision(2)
+       << double(mem) / N << " bytes per element" << endl;
+  auto start_time = chrono::system_clock::now();
+  long long sel0 = 0, rnk0 = 0;
+  for (auto &&q : sel) sel0 += ds.select(q[0], q[1], q[2]);
+  auto end_time = chrono::system_clock::now();
+  double st = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  start_time = chrono::system_clock::now();
+  for (auto &&q : rnk) rnk0 += ds.rank(q[0], q[1], A[q[2] + q[0]]);
+  end_time = chrono::system_clock::now();
+  double rt = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "    select: " << setprecision(0) << st * 1e9 / sel.size()
+       << "ns per query" << endl;
+  cout << "    rank: " << setprecision(0) << rt * 1e9 / rnk.size()
+       << "ns per query" << endl;
+  checkSum = (31 * checkSum + sel0 % int(1e9 + 7)) % (long long)(1e9 + 7);
+  checkSum = (31 * checkSum + rnk0 % int(1e9 + 7)) % (long long)(1e9 + 7);
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  int N = 1e6, Q = 2e5;
+  vector<int> A(N);
+  for (auto &&a : A) a = rng() % int(1e9);
+  vector<array<int, 3>> sel = queries(N, Q, rng), rnk = queries(N, Q, rng);
+  vector<array<int, 3>> selMST(sel.begin(), sel.begin() + Q / 20);
+  long long checkSum = 0, s0 = 0, s1 = 0, s2 = 0;
+  {
+    WaveletMatrix<int> WM(A.begin(), A.end());
+    bench("Wavelet Matrix", N, WM, bytes(WM), sel, rnk, A, checkSum);
+    for (auto &&q : selMST) s0 += WM.select(q[0], q[1], q[2]);
+  }
+  {
+    WaveletTree<int> WT(A.begin(), A.end());
+    bench("Wavelet Tree", N, WT, bytes(WT), sel, rnk, A, checkSum);
+    for (auto &&q : selMST) s1 += WT.select(q[0], q[1], q[2]);
+  }
+  {
+    MergeSortTree<int> MST(A.begin(), A.end());
+    bench("Merge Sort Tree", N, MST, bytes(MST), selMST, rnk, A, checkSum);
+    for (auto &&q : selMST) s2 += MST.select(q[0], q[1], q[2]);
+  }
+  assert(s0 == s1 && s1 == s2);
+  cout << "Subtest 1 (random values) Passed" << endl;
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  int N = 2e7, Q = 2e5, V = 1 << 16;
+  long long checkSum = 0;
+  vector<int> A(N);
+  for (auto &&a : A) a = rng() % V;
+  vector<array<int, 3>> sel = queries(N, Q, rng), rnk = queries(N, Q, rng);
+  WaveletMatrix<int> WM(A.begin(), A.end());
+  bench("Wavelet Matrix", N, WM, bytes(WM), sel, rnk, A, checkSum);
+  for (int i = 0; i < Q; i++) {
+    int j = rng() % N;
+    assert(WM.at(j) == A[j]);
+  }
+  cout << "Subtest 2 (large array, small values) Passed" << endl;
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -1,5 +1,7 @@
 #include <bits/stdc++.h>
+#include "../../../../Content/C++/datastructures/unionfind/ConcurrentUnionFind.h"
 #include "../../../../Content/C++/datastructures/unionfind/UnionFind.h"
+#include "../../../../Content/C++/utils/ThreadPool.h"
 using namespace std;
 
 void test1() {
@@ -37,8 +39,108 @@ void test1() {
   cout << "  Checksum: " << checkSum << endl;
 }
 
+struct Op { int type, v, w, start, end, res; };
+
+// each join is appended to a log after it completes, and each query records
+// the number of completed joins when it starts and the number of joins that
+// had started when it ends, so a query must agree with the sequential
+// structure on some prefix of the log in that range
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 2000, T = 4;
+  ThreadPool pool(T);
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 200 + 1, Q = 1000;
+    ConcurrentUnionFind<> cuf(N, ti);
+    vector<vector<Op>> ops(T);
+    for (auto &&o : ops) for (int i = 0; i < Q; i++) o.push_back(Op{int(rng() % 3), int(rng() % N), int(rng() % N), 0, 0, 0});
+    vector<pair<int, int>> log(T * Q);
+    int logSize = 0, started = 0;
+    pool.run([&] (int t) {
+      for (auto &&op : ops[t]) {
+        if (op.type == 0) {
+          __sync_fetch_and_add(&started, 1);
+          op.res = cuf.join(op.v, op.w);
+          log[__sync_fetch_and_add(&logSize, 1)] = make_pair(op.v, op.w);
+        } else {
+          op.start = __atomic_load_n(&logSize, __ATOMIC_SEQ_CST);
+          op.res = op.type == 1 ? cuf.connected(op.v, op.w) : cuf.getSize(op.v);
+          op.end = __atomic_load_n(&started, __ATOMIC_SEQ_CST);
+        }
+      }
+    });
+    vector<Op> queries;
+    int joined = 0;
+    for (auto &&o : ops) for (auto &&op : o) {
+      if (op.type == 0) joined += op.res;
+      else queries.push_back(op);
+    }
+    sort(queries.begin(), queries.end(), [&] (const Op &a, const Op &b) { return a.start < b.start; });
+    UnionFind uf(N);
+    int j = 0;
+    for (auto &&q : queries) {
+      for (; j < q.start; j++) uf.join(log[j].first, log[j].second);
+      if (q.type == 1) {
+        if (!q.res) assert(!uf.connected(q.v, q.w));
+      } else assert(q.res >= uf.getSize(q.v));
+    }
+    for (; j < logSize; j++) uf.join(log[j].first, log[j].second);
+    assert(joined == N - uf.cnt && cuf.getCount() == uf.cnt);
+    for (int v = 0; v < N; v++) {
+      assert(cuf.getSize(v) == uf.getSize(v));
+      assert(cuf.connected(v, 0) == uf.connected(v, 0));
+    }
+    for (auto &&q : queries) {
+      if (q.type == 1 && q.res) assert(uf.connected(q.v, q.w));
+      if (q.type == 2) assert(q.res <= uf.getSize(q.v));
+    }
+    checkSum = (31 * checkSum + uf.cnt) % (long long)(1e9 + 7);
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test3() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 2000, T = 4;
+  ThreadPool pool(T);
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 200 + 1, Q = 100;
+    ConcurrentUnionFind<false> cuf(N, -1);
+    vector<vector<pair<int, int>>> edges(T);
+    for (auto &&e : edges) for (int i = 0; i < Q; i++) e.emplace_back(rng() % N, rng() % N);
+    vector<int> joined(T, 0);
+    pool.run([&] (int t) {
+      for (auto &&e : edges[t]) joined[t] += cuf.join(e.first, e.second);
+    });
+    UnionFind uf(N);
+    for (auto &&e : edges) for (auto &&p : e) uf.join(p.first, p.second);
+    assert(accumulate(joined.begin(), joined.end(), 0) == N - uf.cnt);
+    vector<int> mn(N, N);
+    for (int v = 0; v < N; v++) mn[uf.find(v)] = min(mn[uf.find(v)], v);
+    for (int v = 0; v < N; v++) {
+      assert(cuf.find(v) == mn[uf.find(v)]);
+      checkSum = (31 * checkSum + cuf.find(v)) % (long long)(1e9 + 7);
+    }
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 3 (no sizes, smaller root) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
 int main() {
   test1();
+  test2();
+  test3();
   cout << "Test Passed" << endl;
   return 0;
 }
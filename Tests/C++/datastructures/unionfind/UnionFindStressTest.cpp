@@ -1,5 +1,7 @@
 #include <bits/stdc++.h>
+#include "../../../../Content/C++/datastructures/unionfind/ConcurrentUnionFind.h"
 #include "../../../../Content/C++/datastructures/unionfind/UnionFind.h"
+#include "../../../../Content/C++/utils/ThreadPool.h"
 using namespace std;
 
 void test1() {
@@ -27,8 +29,69 @@ void test1() {
   cout << "  Checksum: " << checkSum << endl;
 }
 
+void test2() {
+  mt19937_64 rng(0);
+  int N = 2e6, Q = 1e7;
+  vector<pair<int, int>> ops(Q);
+  for (auto &&op : ops) op = make_pair(rng() % N, rng() % N);
+  UnionFind uf(N);
+  auto start_time = chrono::system_clock::now();
+  for (auto &&op : ops) uf.join(op.first, op.second);
+  auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 Passed" << endl;
+  cout << "  N: " << N << endl;
+  cout << "  Q: " << Q << endl;
+  cout << "  Time (UnionFind): " << fixed << setprecision(3) << sec << "s" << endl;
+  start_time = chrono::system_clock::now();
+  mutex m;
+  {
+    UnionFind muf(N);
+    ThreadPool pool(4);
+    pool.parallelFor(Q, [&] (int, long long lo, long long hi) {
+      for (long long i = lo; i < hi; i++) {
+        lock_guard<mutex> lock(m);
+        muf.join(ops[i].first, ops[i].second);
+      }
+    }, 1 << 12);
+    assert(muf.cnt == uf.cnt);
+  }
+  end_time = chrono::system_clock::now();
+  sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "  Time (UnionFind with mutex, 4 threads): " << fixed << setprecision(3) << sec << "s" << endl;
+  long long checkSum = 0;
+  for (int T = 1; T <= 8; T *= 2) {
+    ConcurrentUnionFind<> cuf(N);
+    ThreadPool pool(T);
+    vector<long long> sizes(T, 0);
+    start_time = chrono::system_clock::now();
+    pool.parallelFor(Q, [&] (int t, long long lo, long long hi) {
+      for (long long i = lo; i < hi; i++) {
+        if (i % 2 == 0) cuf.join(ops[i].first, ops[i].second);
+        else {
+          cuf.join(ops[i].first, ops[i].second);
+          sizes[t] += cuf.getSize(ops[i].first);
+        }
+      }
+    }, 1 << 12);
+    end_time = chrono::system_clock::now();
+    sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    assert(cuf.getCount() == uf.cnt);
+    for (int v = 0; v < N; v++) assert(cuf.getSize(v) == uf.getSize(v));
+    for (int i = 0; i < 1000; i++) {
+      int v = rng() % N, w = rng() % N;
+      assert(cuf.connected(v, w) == uf.connected(v, w));
+    }
+    cout << "  Time (ConcurrentUnionFind, " << T << " thread(s)): " << fixed << setprecision(3) << sec << "s" << endl;
+    cout << "  Throughput (ConcurrentUnionFind, " << T << " thread(s)): " << fixed << setprecision(3) << Q / sec / 1e6 << "M ops/s" << endl;
+    if (T == 1) checkSum = accumulate(sizes.begin(), sizes.end(), 0LL) % (long long)(1e9 + 7);
+  }
+  cout << "  Checksum: " << checkSum << endl;
+}
+
 int main() {
   test1();
+  test2();
   cout << "Test Passed" << endl;
   return 0;
 }
@@ -1,5 +1,7 @@
 #include <bits/stdc++.h>
 #include "../../../../Content/C++/graph/components/ConnectedComponents.h"
+#include "../../../../Content/C++/graph/components/ParallelConnectedComponents.h"
+#include "../../../../Content/C++/graph/representations/StaticGraph.h"
 using namespace std;
 
 void test1() {
@@ -24,8 +26,77 @@ void test1() {
   cout << "  Checksum: " << checkSum << endl;
 }
 
+void checkSame(const CC &cc, const ParallelCC &pcc) {
+  assert(cc.components.size() == pcc.components.size());
+  vector<int> mp(cc.components.size(), -1);
+  for (int v = 0; v < cc.V; v++) {
+    if (mp[cc.id[v]] == -1) mp[cc.id[v]] = pcc.id[v];
+    assert(mp[cc.id[v]] == pcc.id[v]);
+  }
+  for (int i = 0; i < int(pcc.components.size()); i++) {
+    assert(is_sorted(pcc.components[i].begin(), pcc.components[i].end()));
+    for (int v : pcc.components[i]) assert(pcc.id[v] == i);
+    if (i > 0) assert(pcc.components[i - 1][0] < pcc.components[i][0]);
+  }
+}
+
+void test2(int subtest, const string &name, int V, const vector<pair<int, int>> &edges) {
+  CC cc(V);
+  auto start_time = chrono::system_clock::now();
+  for (auto &&e : edges) cc.addEdge(e.first, e.second);
+  cc.assign();
+  auto end_time = chrono::system_clock::now();
+  double ccSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  StaticGraph G(V);
+  G.reserveDiEdges(edges.size() * 2);
+  for (auto &&e : edges) G.addBiEdge(e.first, e.second);
+  G.build();
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  E: " << edges.size() << endl;
+  cout << "  Time (CC): " << fixed << setprecision(3) << ccSec << "s" << endl;
+  long long checkSum = cc.components.size();
+  for (int T = 1; T <= 8; T *= 2) {
+    ThreadPool pool(T);
+    start_time = chrono::system_clock::now();
+    ParallelCC pcc0(V, edges, pool);
+    end_time = chrono::system_clock::now();
+    double edgeSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    start_time = chrono::system_clock::now();
+    ParallelCC pcc1(G, pool);
+    end_time = chrono::system_clock::now();
+    double graphSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    checkSame(cc, pcc0);
+    checkSame(cc, pcc1);
+    assert(pcc0.id == pcc1.id);
+    cout << "  Time (ParallelCC, edge list, " << T << " thread(s)): " << fixed << setprecision(3) << edgeSec << "s" << endl;
+    cout << "  Time (ParallelCC, StaticGraph, " << T << " thread(s)): " << fixed << setprecision(3) << graphSec << "s" << endl;
+    if (T == 1) for (int v = 0; v < V; v++) checkSum = (31 * checkSum + pcc1.id[v]) % (long long)(1e9 + 7);
+  }
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  mt19937_64 rng(0);
+  int V = 2e6, E = 4e6;
+  vector<pair<int, int>> edges;
+  for (int i = 0; i < E; i++) {
+    int c = rng() % 100;
+    int v = rng() % (V / 100) + (V / 100) * c, w = rng() % (V / 100) + (V / 100) * c;
+    edges.emplace_back(v, w);
+  }
+  test2(2, "clustered", V, edges);
+  edges.clear();
+  for (int i = 0; i < E * 2; i++) edges.emplace_back(rng() % V, rng() % V);
+  test2(3, "random", V, edges);
+  edges.clear();
+  for (int i = 0; i < V / 2; i++) edges.emplace_back(rng() % V, rng() % V);
+  test2(4, "sparse", V, edges);
+}
+
 int main() {
   test1();
+  test2();
   cout << "Test Passed" << endl;
   return 0;
 }
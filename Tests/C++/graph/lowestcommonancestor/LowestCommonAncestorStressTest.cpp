@@ -0,0 +1,125 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/graph/lowestcommonancestor/LowestCommonAncestor.h"
+#include "../../../../Content/C++/graph/lowestcommonancestor/OfflineLowestCommonAncestor.h"
+#include "../../../../Content/C++/graph/representations/StaticGraph.h"
+using namespace std;
+
+StaticGraph randomForest(int V, int components, mt19937_64 &rng,
+                         vector<int> &par) {
+  vector<int> perm(V);
+  iota(perm.begin(), perm.end(), 0);
+  shuffle(perm.begin(), perm.end(), rng);
+  StaticGraph G(V);
+  G.reserveDiEdges(V * 2);
+  par.assign(V, -1);
+  for (int i = components; i < V; i++) {
+    int p = perm[rng() % i];
+    par[perm[i]] = p;
+    G.addBiEdge(perm[i], p);
+  }
+  G.build();
+  return G;
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1e4;
+  ThreadPool pool(4);
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int V = rng() % 100 + 1, C = rng() % min(V, 3) + 1;
+    vector<int> par;
+    StaticGraph G = randomForest(V, C, rng, par);
+    vector<int> depth(V, -1);
+    function<int(int)> getDepth = [&] (int v) {
+      if (depth[v] != -1) return depth[v];
+      return depth[v] = par[v] == -1 ? 0 : getDepth(par[v]) + 1;
+    };
+    vector<int> roots;
+    for (int v = 0; v < V; v++) if (getDepth(v) == 0) roots.push_back(v);
+    int Q = ti < 100 ? 1e5 : 100;
+    vector<pair<int, int>> queries(Q);
+    for (auto &&q : queries) q = make_pair(rng() % V, rng() % V);
+    LCA<> lca(G, roots);
+    OfflineLCA offline(G, queries, roots);
+    vector<int> ans0(Q), ans1(Q);
+    for (int i = 0; i < Q; i++) {
+      int v = queries[i].first, w = queries[i].second;
+      while (depth[v] > depth[w]) v = par[v];
+      while (depth[w] > depth[v]) w = par[w];
+      while (v != w && v != -1) { v = par[v]; w = par[w]; }
+      ans0[i] = v;
+      bool connected = lca.connected(queries[i].first, queries[i].second);
+      assert(connected == (v != -1));
+      ans1[i] = connected ? lca.lca(queries[i].first, queries[i].second) : -1;
+    }
+    assert(ans0 == ans1);
+    assert(ans0 == offline.ans);
+    vector<int> ans2 = lca.lca(queries), ans3 = lca.lca(queries, pool);
+    assert(ans2 == ans3);
+    for (int i = 0; i < Q; i++) if (ans0[i] != -1) assert(ans0[i] == ans2[i]);
+    for (auto &&a : ans0) checkSum = (31 * checkSum + a) % (long long)(1e9 + 7);
+  }
+  cout << "Subtest 1 (correctness) Passed" << endl;
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test(int subtest, int V, int Q) {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  vector<int> par;
+  StaticGraph G = randomForest(V, 1, rng, par);
+  vector<pair<int, int>> queries(Q);
+  for (auto &&q : queries) q = make_pair(rng() % V, rng() % V);
+  LCA<> lca(G);
+  auto t = chrono::system_clock::now();
+  vector<int> ans0(Q);
+  for (int i = 0; i < Q; i++)
+    ans0[i] = lca.lca(queries[i].first, queries[i].second);
+  auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - t).count() / double(chrono::system_clock::period::den));
+  cout << "  Per-query loop: " << fixed << setprecision(3) << sec
+       << "s" << endl;
+  t = chrono::system_clock::now();
+  vector<int> ans1 = lca.lca(queries);
+  end_time = chrono::system_clock::now();
+  sec = ((end_time - t).count() / double(chrono::system_clock::period::den));
+  cout << "  Batch: " << fixed << setprecision(3) << sec << "s" << endl;
+  assert(ans0 == ans1);
+  ThreadPool pool;
+  t = chrono::system_clock::now();
+  vector<int> ans2 = lca.lca(queries, pool);
+  end_time = chrono::system_clock::now();
+  sec = ((end_time - t).count() / double(chrono::system_clock::period::den));
+  cout << "  Batch (" << pool.size() << " threads): " << fixed
+       << setprecision(3) << sec << "s" << endl;
+  assert(ans0 == ans2);
+  t = chrono::system_clock::now();
+  OfflineLCA offline(G, queries);
+  end_time = chrono::system_clock::now();
+  sec = ((end_time - t).count() / double(chrono::system_clock::period::den));
+  cout << "  Offline (Tarjan): " << fixed << setprecision(3) << sec
+       << "s" << endl;
+  assert(ans0 == offline.ans);
+  long long checkSum = 0;
+  for (auto &&a : ans0) checkSum = (31 * checkSum + a) % (long long)(1e9 + 7);
+  cout << "Subtest " << subtest << " (V = " << V << ", Q = " << Q
+       << ") Passed" << endl;
+  end_time = chrono::system_clock::now();
+  sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test(2, 1e3, 1e7);
+  test(3, 1e6, 1e7);
+  test(4, 4e6, 1e7);
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -1,6 +1,8 @@
 #include <bits/stdc++.h>
 #include "../../../../Content/C++/graph/minimumspanningtree/BoruvkaMST.h"
+#include "../../../../Content/C++/graph/minimumspanningtree/FilterKruskalMST.h"
 #include "../../../../Content/C++/graph/minimumspanningtree/KruskalMST.h"
+#include "../../../../Content/C++/graph/minimumspanningtree/ParallelBoruvkaMST.h"
 #include "../../../../Content/C++/graph/minimumspanningtree/PrimMST.h"
 #include "../../../../Content/C++/graph/representations/StaticGraph.h"
 using namespace std;
@@ -207,6 +209,91 @@ void test7() {
   cout << "  Checksum: " << checkSum << endl;
 }
 
+template <class MST> void checkSame(const MST &mst, const KruskalMST<long long> &kruskal) {
+  assert(mst.mstWeight == kruskal.mstWeight);
+  assert(mst.mstEdges.size() == kruskal.mstEdges.size());
+}
+
+void compareAll(int subtest, const string &name, int V, const vector<tuple<int, int, long long>> &edges) {
+  int E = edges.size();
+  ostringstream out;
+  auto start_time = chrono::system_clock::now();
+  KruskalMST<long long> kruskal(V, edges);
+  auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  out << "  Time (Kruskal): " << fixed << setprecision(3) << sec << "s" << endl;
+  start_time = chrono::system_clock::now();
+  BoruvkaMST<long long> boruvka(V, edges);
+  end_time = chrono::system_clock::now();
+  sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  out << "  Time (Boruvka): " << fixed << setprecision(3) << sec << "s" << endl;
+  checkSame(boruvka, kruskal);
+  StaticWeightedGraph<long long> G(V);
+  G.reserveDiEdges(E * 2);
+  for (auto &&e : edges) G.addBiEdge(get<0>(e), get<1>(e), get<2>(e));
+  G.build();
+  start_time = chrono::system_clock::now();
+  PrimMST<long long> prim(G);
+  end_time = chrono::system_clock::now();
+  sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  out << "  Time (Prim): " << fixed << setprecision(3) << sec << "s" << endl;
+  checkSame(prim, kruskal);
+  vector<tuple<int, int, long long>> boruvkaEdges = boruvka.mstEdges;
+  sort(boruvkaEdges.begin(), boruvkaEdges.end());
+  for (int T = 1; T <= 4; T *= 4) {
+    ThreadPool pool(T);
+    vector<tuple<int, int, long long>> copy = edges;
+    start_time = chrono::system_clock::now();
+    FilterKruskalMST<long long> filterKruskal(V, copy, pool);
+    end_time = chrono::system_clock::now();
+    double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    out << "  Time (Filter-Kruskal, " << T << " thread(s)): " << fixed << setprecision(3) << sec << "s" << endl;
+    out << "  Throughput (Filter-Kruskal, " << T << " thread(s)): " << fixed << setprecision(3) << E / sec / 1e6 << "M edges/s" << endl;
+    checkSame(filterKruskal, kruskal);
+    start_time = chrono::system_clock::now();
+    ParallelBoruvkaMST<long long> parallelBoruvka(V, edges, pool);
+    end_time = chrono::system_clock::now();
+    sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    out << "  Time (Parallel Boruvka, " << T << " thread(s)): " << fixed << setprecision(3) << sec << "s" << endl;
+    out << "  Throughput (Parallel Boruvka, " << T << " thread(s)): " << fixed << setprecision(3) << E / sec / 1e6 << "M edges/s" << endl;
+    checkSame(parallelBoruvka, kruskal);
+    sort(parallelBoruvka.mstEdges.begin(), parallelBoruvka.mstEdges.end());
+    assert(parallelBoruvka.mstEdges == boruvkaEdges);
+  }
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  E: " << E << endl;
+  cout << out.str();
+  cout << "  Checksum: " << kruskal.mstWeight % (long long)(1e9 + 7) << endl;
+}
+
+void test8() {
+  mt19937_64 rng(0);
+  vector<tuple<int, int, long long>> edges;
+  int V = 1e4, E = 5e6;
+  for (int i = 0; i < E; i++) edges.emplace_back(rng() % V, rng() % V, rng() % (long long)(1e9) + 1);
+  compareAll(8, "random, dense", V, edges);
+  edges.clear();
+  V = 1e6;
+  for (int i = 0; i < E; i++) edges.emplace_back(rng() % V, rng() % V, rng() % (long long)(1e9) + 1);
+  compareAll(9, "random, sparse", V, edges);
+  edges.clear();
+  int R = 500, C = 500, D = 3;
+  V = R * C;
+  vector<long long> X(V), Y(V);
+  for (int v = 0; v < V; v++) {
+    X[v] = (v / C) * 1000 + rng() % 1000;
+    Y[v] = (v % C) * 1000 + rng() % 1000;
+  }
+  for (int i = 0; i < R; i++) for (int j = 0; j < C; j++) for (int di = 0; di <= D; di++) for (int dj = -D; dj <= D; dj++) {
+    if ((di == 0 && dj <= 0) || i + di >= R || j + dj < 0 || j + dj >= C) continue;
+    int v = i * C + j, w = (i + di) * C + j + dj;
+    edges.emplace_back(v, w, (X[v] - X[w]) * (X[v] - X[w]) + (Y[v] - Y[w]) * (Y[v] - Y[w]));
+  }
+  shuffle(edges.begin(), edges.end(), rng);
+  compareAll(10, "geometric", V, edges);
+}
+
 int main() {
   test1();
   test2();
@@ -215,6 +302,7 @@ int main() {
   test5();
   test6();
   test7();
+  test8();
   cout << "Test Passed" << endl;
   return 0;
 }
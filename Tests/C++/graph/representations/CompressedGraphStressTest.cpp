@@ -0,0 +1,99 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/graph/components/StronglyConnectedComponents.h"
+#include "../../../../Content/C++/graph/representations/CompressedGraph.h"
+#include "../../../../Content/C++/graph/representations/StaticGraph.h"
+#include "../../../../Content/C++/graph/search/BreadthFirstSearch.h"
+using namespace std;
+
+void compare(const string &name, int subtest, const StaticGraph &G) {
+  auto start_time = chrono::system_clock::now();
+  CompressedGraph CG(G);
+  auto end_time = chrono::system_clock::now();
+  double buildSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  long long E = G.TO.size();
+  for (int v = 0; v < G.size(); v++) {
+    vector<int> a, b;
+    for (int w : G[v]) a.push_back(w);
+    for (int w : CG[v]) b.push_back(w);
+    sort(a.begin(), a.end());
+    assert(a == b);
+  }
+  start_time = chrono::system_clock::now();
+  BFS<> bfs0(G, 0);
+  end_time = chrono::system_clock::now();
+  double bfsSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  start_time = chrono::system_clock::now();
+  BFS<> bfs1(CG, 0);
+  end_time = chrono::system_clock::now();
+  double compressedBfsSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  assert(bfs0.dist == bfs1.dist);
+  start_time = chrono::system_clock::now();
+  SCC scc0(G);
+  end_time = chrono::system_clock::now();
+  double sccSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  start_time = chrono::system_clock::now();
+  SCC scc1(CG);
+  end_time = chrono::system_clock::now();
+  double compressedSccSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  assert(scc0.components.size() == scc1.components.size());
+  long long staticBytes = G.ST.size() * sizeof(int) + G.TO.size() * sizeof(int);
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  V: " << G.size() << endl;
+  cout << "  E: " << E << endl;
+  cout << "  Compression Time: " << fixed << setprecision(3) << buildSec << "s" << endl;
+  cout << "  Bytes Per Edge (StaticGraph): " << fixed << setprecision(3) << double(staticBytes) / E << endl;
+  cout << "  Bytes Per Edge (CompressedGraph): " << fixed << setprecision(3) << double(CG.bytes()) / E << endl;
+  cout << "  BFS Time (StaticGraph): " << fixed << setprecision(3) << bfsSec << "s" << endl;
+  cout << "  BFS Time (CompressedGraph): " << fixed << setprecision(3) << compressedBfsSec << "s" << endl;
+  cout << "  SCC Time (StaticGraph): " << fixed << setprecision(3) << sccSec << "s" << endl;
+  cout << "  SCC Time (CompressedGraph): " << fixed << setprecision(3) << compressedSccSec << "s" << endl;
+  long long checkSum = 0;
+  for (auto &&d : bfs1.dist) checkSum = (31 * checkSum + d) % (long long)(1e9 + 7);
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test1() {
+  mt19937_64 rng(0);
+  int V = 1e6, E = 1e7;
+  StaticGraph G(V);
+  G.reserveDiEdges(E);
+  for (int i = 0; i < E; i++) {
+    int v = rng() % V, w = rng() % V;
+    G.addDiEdge(v, w);
+  }
+  G.build();
+  compare("Random", 1, G);
+}
+
+void test2() {
+  int R = 2000, C = 2000;
+  StaticGraph G(R * C);
+  G.reserveDiEdges(R * C * 4);
+  for (int i = 0; i < R; i++) for (int j = 0; j < C; j++) {
+    if (i + 1 < R) G.addBiEdge(i * C + j, (i + 1) * C + j);
+    if (j + 1 < C) G.addBiEdge(i * C + j, i * C + j + 1);
+  }
+  G.build();
+  compare("Grid", 2, G);
+}
+
+void test3() {
+  mt19937_64 rng(0);
+  int V = 1e6, E = 5e6;
+  StaticGraph G(V);
+  G.reserveDiEdges(E * 2);
+  for (int i = 0; i < E; i++) {
+    int v = rng() % V, w = max(0, min(V - 1, v + int(rng() % 2001) - 1000));
+    G.addBiEdge(v, w);
+  }
+  G.build();
+  compare("Local", 3, G);
+}
+
+int main() {
+  test1();
+  test2();
+  test3();
+  cout << "Test Passed" << endl;
+  return 0;
+}
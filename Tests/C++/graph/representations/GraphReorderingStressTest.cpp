@@ -0,0 +1,162 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/graph/components/StronglyConnectedComponents.h"
+#include "../../../../Content/C++/graph/representations/GraphReordering.h"
+#include "../../../../Content/C++/graph/representations/StaticGraph.h"
+#include "../../../../Content/C++/graph/search/BreadthFirstSearch.h"
+#include "../../../../Content/C++/graph/search/CuthillMcKee.h"
+#include "../../../../Content/C++/graph/shortestpath/DijkstraSSSP.h"
+using namespace std;
+
+struct Result {
+  vector<int> bfsDist, bfsPar, sccId;
+  vector<long long> ssspDist;
+};
+
+template <class F> void run(const string &name, int subtest, const StaticGraph &G, const StaticWeightedGraph<long long> &WG, const Result &base, F getOrder) {
+  int V = G.size(), s = 0;
+  auto start_time = chrono::system_clock::now();
+  GraphReordering R(getOrder(G));
+  StaticGraph H = R.apply(G);
+  StaticWeightedGraph<long long> WH = R.apply(WG);
+  auto end_time = chrono::system_clock::now();
+  double reorderSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  start_time = chrono::system_clock::now();
+  BFS<> bfs(H, R.ind[s]);
+  end_time = chrono::system_clock::now();
+  double bfsSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  start_time = chrono::system_clock::now();
+  DijkstraSSSP<long long> sssp(WH, R.ind[s]);
+  end_time = chrono::system_clock::now();
+  double ssspSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  start_time = chrono::system_clock::now();
+  SCC scc(H);
+  end_time = chrono::system_clock::now();
+  double sccSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  vector<int> bfsDist = R.fromNew(bfs.dist), bfsPar = R.fromNewVertices(bfs.par), sccId = R.fromNew(scc.id);
+  vector<long long> ssspDist = R.fromNew(sssp.dist);
+  assert(bfsDist == base.bfsDist);
+  assert(ssspDist == base.ssspDist);
+  for (int v = 0; v < V; v++) if (bfsPar[v] != -1) {
+    assert(bfsDist[bfsPar[v]] + 1 == bfsDist[v]);
+    bool found = false;
+    for (int w : G[bfsPar[v]]) found |= w == v;
+    assert(found);
+  }
+  int K = scc.components.size();
+  vector<int> mp(K, -1);
+  for (int v = 0; v < V; v++) {
+    if (mp[sccId[v]] == -1) mp[sccId[v]] = base.sccId[v];
+    assert(mp[sccId[v]] == base.sccId[v]);
+  }
+  long long span = 0;
+  for (int v = 0; v < V; v++) for (int w : H[v]) span += abs(v - w);
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  E: " << G.TO.size() << endl;
+  cout << "  Average Edge Span: " << fixed << setprecision(3) << double(span) / G.TO.size() << endl;
+  cout << "  Reorder Time: " << fixed << setprecision(3) << reorderSec << "s" << endl;
+  cout << "  BFS Time: " << fixed << setprecision(3) << bfsSec << "s" << endl;
+  cout << "  Dijkstra Time: " << fixed << setprecision(3) << ssspSec << "s" << endl;
+  cout << "  SCC Time: " << fixed << setprecision(3) << sccSec << "s" << endl;
+  long long checkSum = K;
+  for (auto &&d : ssspDist) checkSum = (31 * checkSum + d) % (long long)(1e9 + 7);
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void runAll(const string &name, int &subtest, const StaticGraph &G, const StaticWeightedGraph<long long> &WG) {
+  Result base;
+  BFS<> bfs(G, 0);
+  base.bfsDist = bfs.dist;
+  base.ssspDist = DijkstraSSSP<long long>(WG, 0).dist;
+  base.sccId = SCC(G).id;
+  run(name + ", original", subtest++, G, WG, base, [&] (const StaticGraph &G) {
+    vector<int> ord(G.size());
+    iota(ord.begin(), ord.end(), 0);
+    return ord;
+  });
+  run(name + ", degreeOrder", subtest++, G, WG, base, [&] (const StaticGraph &G) { return degreeOrder(G); });
+  run(name + ", bfsOrder", subtest++, G, WG, base, [&] (const StaticGraph &G) { return bfsOrder(G); });
+  run(name + ", reverseCuthillMcKeeOrder", subtest++, G, WG, base, [&] (const StaticGraph &G) { return reverseCuthillMcKeeOrder(G); });
+  run(name + ", bisectionOrder", subtest++, G, WG, base, [&] (const StaticGraph &G) { return bisectionOrder(G); });
+}
+
+void build(const vector<pair<int, int>> &edges, int V, StaticGraph &G, StaticWeightedGraph<long long> &WG) {
+  mt19937_64 rng(1);
+  vector<int> P(V);
+  iota(P.begin(), P.end(), 0);
+  shuffle(P.begin(), P.end(), rng);
+  G.reserveDiEdges(edges.size());
+  WG.reserveDiEdges(edges.size());
+  for (auto &&e : edges) {
+    G.addDiEdge(P[e.first], P[e.second]);
+    WG.addDiEdge(P[e.first], P[e.second], rng() % int(1e6) + 1);
+  }
+  G.build();
+  WG.build();
+}
+
+void test1() {
+  mt19937_64 rng(0);
+  int R = 1000, C = 1000, V = R * C;
+  vector<pair<int, int>> edges;
+  for (int i = 0; i < R; i++) for (int j = 0; j < C; j++) {
+    int v = i * C + j;
+    if (i + 1 < R) {
+      if (rng() % 10 < 8) edges.emplace_back(v, v + C);
+      if (rng() % 10 < 8) edges.emplace_back(v + C, v);
+    }
+    if (j + 1 < C) {
+      if (rng() % 10 < 8) edges.emplace_back(v, v + 1);
+      if (rng() % 10 < 8) edges.emplace_back(v + 1, v);
+    }
+  }
+  StaticGraph G(V);
+  StaticWeightedGraph<long long> WG(V);
+  build(edges, V, G, WG);
+  int subtest = 1;
+  runAll("Shuffled Grid", subtest, G, WG);
+}
+
+void test2() {
+  mt19937_64 rng(0);
+  int V = 1e6, E = 4e6;
+  vector<pair<int, int>> edges;
+  for (int i = 0; i < E; i++) {
+    int v = rng() % V, w = max(0, min(V - 1, v + int(rng() % 201) - 100));
+    edges.emplace_back(v, w);
+  }
+  StaticGraph G(V);
+  StaticWeightedGraph<long long> WG(V);
+  build(edges, V, G, WG);
+  int subtest = 6;
+  runAll("Shuffled Local", subtest, G, WG);
+}
+
+void test3() {
+  const int MAXV = 1000;
+  mt19937_64 rng(0);
+  unique_ptr<CuthillMcKee<MAXV>> cm(new CuthillMcKee<MAXV>());
+  for (int ti = 0; ti < 100; ti++) {
+    int V = rng() % MAXV + 1, E = rng() % (V * 3);
+    StaticGraph G(V);
+    G.reserveDiEdges(E * 2);
+    cm->clear(V);
+    for (int i = 0; i < E; i++) {
+      int v = rng() % V, w = rng() % V;
+      G.addBiEdge(v, w);
+      cm->addEdge(v, w);
+    }
+    G.build();
+    cm->run(V, true);
+    assert(reverseCuthillMcKeeOrder(G) == vector<int>(cm->ord, cm->ord + V));
+  }
+  cout << "Subtest 11 (reverseCuthillMcKeeOrder matches CuthillMcKee) Passed" << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  test3();
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,94 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/graph/components/StronglyConnectedComponents.h"
+#include "../../../../Content/C++/graph/representations/MappedStaticGraph.h"
+#include "../../../../Content/C++/graph/representations/StaticGraph.h"
+#include "../../../../Content/C++/graph/search/BreadthFirstSearch.h"
+#include "../../../../Content/C++/graph/shortestpath/DijkstraSSSP.h"
+using namespace std;
+
+void test1() {
+  mt19937_64 rng(0);
+  int V = 2e6, E = 1e7;
+  vector<pair<int, int>> edges;
+  for (int i = 0; i < E; i++) edges.emplace_back(rng() % V, rng() % V);
+  auto start_time = chrono::system_clock::now();
+  StaticGraph G(V);
+  G.reserveDiEdges(E);
+  for (auto &&e : edges) G.addDiEdge(e.first, e.second);
+  G.build();
+  auto end_time = chrono::system_clock::now();
+  double buildSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  string filename = "MappedStaticGraphStressTest.bin";
+  start_time = chrono::system_clock::now();
+  writeCSRFile(G, filename);
+  end_time = chrono::system_clock::now();
+  double writeSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  start_time = chrono::system_clock::now();
+  MappedStaticGraph MG(filename);
+  end_time = chrono::system_clock::now();
+  double mapSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  assert(MG.size() == G.size());
+  start_time = chrono::system_clock::now();
+  BFS<> bfs0(G, 0);
+  end_time = chrono::system_clock::now();
+  double bfsSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  start_time = chrono::system_clock::now();
+  BFS<> bfs1(MG, 0);
+  end_time = chrono::system_clock::now();
+  double mappedBfsSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  assert(bfs0.dist == bfs1.dist);
+  assert(bfs0.par == bfs1.par);
+  SCC scc0(G), scc1(MG);
+  assert(scc0.id == scc1.id);
+  remove(filename.c_str());
+  cout << "Subtest 1 Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  E: " << E << endl;
+  cout << "  Build Time: " << fixed << setprecision(3) << buildSec << "s" << endl;
+  cout << "  Write Time: " << fixed << setprecision(3) << writeSec << "s" << endl;
+  cout << "  Map Time: " << fixed << setprecision(3) << mapSec << "s" << endl;
+  cout << "  BFS Time (StaticGraph): " << fixed << setprecision(3) << bfsSec << "s" << endl;
+  cout << "  BFS Time (MappedStaticGraph): " << fixed << setprecision(3) << mappedBfsSec << "s" << endl;
+  long long checkSum = 0;
+  for (auto &&d : bfs1.dist) checkSum = (31 * checkSum + d) % (long long)(1e9 + 7);
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  mt19937_64 rng(0);
+  int V = 1e6, E = 5e6;
+  StaticWeightedGraph<long long> G(V);
+  G.reserveDiEdges(E);
+  for (int i = 0; i < E; i++) G.addDiEdge(rng() % V, rng() % V, rng() % int(1e9));
+  G.build();
+  string filename = "MappedStaticGraphStressTest.bin";
+  writeCSRFile(G, filename);
+  bool threw = false;
+  try {
+    MappedStaticWeightedGraph<int> bad(filename);
+  } catch (const runtime_error &) {
+    threw = true;
+  }
+  assert(threw);
+  MappedStaticWeightedGraph<long long> MG(filename);
+  const auto start_time = chrono::system_clock::now();
+  DijkstraSSSP<long long> sssp(MG, 0);
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  assert(sssp.dist == DijkstraSSSP<long long>(G, 0).dist);
+  remove(filename.c_str());
+  cout << "Subtest 2 Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  E: " << E << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  long long checkSum = 0;
+  for (auto &&d : sssp.dist) checkSum = (31 * checkSum + d) % (long long)(1e9 + 7);
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  cout << "Test Passed" << endl;
+  return 0;
+}
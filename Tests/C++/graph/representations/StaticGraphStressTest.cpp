@@ -0,0 +1,153 @@
+#include <bits/stdc++.h>
+#include <malloc.h>
+#include "../../../../Content/C++/graph/representations/StaticGraph.h"
+using namespace std;
+
+size_t curBytes = 0, peakBytes = 0;
+
+__attribute__((noinline)) void *operator new (size_t n) {
+  void *p = malloc(n);
+  if (!p) throw bad_alloc();
+  peakBytes = max(peakBytes, curBytes += malloc_usable_size(p));
+  return p;
+}
+void *operator new[] (size_t n) { return operator new (n); }
+__attribute__((noinline)) void operator delete (void *p) noexcept {
+  if (!p) return;
+  curBytes -= malloc_usable_size(p);
+  free(p);
+}
+void operator delete[] (void *p) noexcept { operator delete (p); }
+void operator delete (void *p, size_t) noexcept { operator delete (p); }
+void operator delete[] (void *p, size_t) noexcept { operator delete (p); }
+
+const int V = 1e6, E = 2e7;
+
+template <class F> void run(const string &name, int subtest, F f) {
+  size_t base = curBytes;
+  peakBytes = curBytes;
+  const auto start_time = chrono::system_clock::now();
+  StaticGraph G = f();
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  size_t kept = G.ST.capacity() * sizeof(int) + G.TO.capacity() * sizeof(int) + G.A.capacity() * sizeof(int) + G.B.capacity() * sizeof(int);
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  E: " << E << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Peak Bytes Per Edge: " << fixed << setprecision(3) << double(peakBytes - base) / E << endl;
+  cout << "  Retained Bytes Per Edge: " << fixed << setprecision(3) << double(kept) / E << endl;
+  long long checkSum = 0;
+  for (int v = 0; v < V; v++) for (int w : G[v]) checkSum = (31 * checkSum + w) % (long long)(1e9 + 7);
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void generate(int t, int P, StaticGraph::EdgeSink f) {
+  mt19937_64 rng(t);
+  for (int i = E / P * t; i < (t == P - 1 ? E : E / P * (t + 1)); i++) {
+    int v = rng() % V, w = rng() % V;
+    f(v, w);
+  }
+}
+
+StaticGraph buildWithAddDiEdge() {
+  StaticGraph G(V);
+  G.reserveDiEdges(E);
+  mt19937_64 rng(0);
+  for (int i = 0; i < E; i++) {
+    int v = rng() % V, w = rng() % V;
+    G.addDiEdge(v, w);
+  }
+  G.build();
+  return G;
+}
+
+void test1() {
+  run("addDiEdge and build()", 1, buildWithAddDiEdge);
+}
+
+void test2() {
+  StaticGraph G0 = buildWithAddDiEdge();
+  run("build(gen)", 2, [&] {
+    StaticGraph G(V);
+    G.build([&] (StaticGraph::EdgeSink f) { generate(0, 1, f); });
+    assert(G.ST == G0.ST);
+    assert(G.TO == G0.TO);
+    return G;
+  });
+}
+
+void test3() {
+  StaticGraph G0 = buildWithAddDiEdge();
+  run("build(deg, gen)", 3, [&] {
+    vector<int> deg(V, 0);
+    mt19937_64 rng(0);
+    for (int i = 0; i < E; i++) {
+      deg[rng() % V]++;
+      rng();
+    }
+    StaticGraph G(V);
+    G.build(deg, [&] (StaticGraph::EdgeSink f) { generate(0, 1, f); });
+    assert(G.ST == G0.ST);
+    assert(G.TO == G0.TO);
+    return G;
+  });
+}
+
+void test4() {
+  StaticGraph G0(V);
+  G0.reserveDiEdges(E);
+  for (int t = 0; t < 4; t++) {
+    mt19937_64 rng(t);
+    for (int i = E / 4 * t; i < E / 4 * (t + 1); i++) {
+      int v = rng() % V, w = rng() % V;
+      G0.addDiEdge(v, w);
+    }
+  }
+  G0.build();
+  for (int T = 1; T <= 4; T *= 2) {
+    ThreadPool pool(T);
+    run("build(gen, pool), " + to_string(T) + " thread(s)", 4, [&] {
+      StaticGraph G(V);
+      G.build([&] (int t, int P, StaticGraph::EdgeSink f) {
+        for (int i = 4 * t / P; i < 4 * (t + 1) / P; i++) generate(i, 4, f);
+      }, pool);
+      assert(G.ST == G0.ST);
+      assert(G.TO == G0.TO);
+      return G;
+    });
+  }
+}
+
+void test5() {
+  StaticWeightedGraph<long long> G0(V), G1(V);
+  mt19937_64 rng(0);
+  G0.reserveDiEdges(E / 4);
+  for (int i = 0; i < E / 4; i++) {
+    int v = rng() % V, w = rng() % V;
+    G0.addDiEdge(v, w, rng() % int(1e9));
+  }
+  G0.build();
+  assert(G0.A.capacity() == 0 && G0.C.capacity() == 0);
+  G1.build([&] (StaticWeightedGraph<long long>::EdgeSink f) {
+    mt19937_64 rng(0);
+    for (int i = 0; i < E / 4; i++) {
+      int v = rng() % V, w = rng() % V;
+      f(v, w, rng() % int(1e9));
+    }
+  });
+  assert(G0.ST == G1.ST);
+  assert(G0.TO == G1.TO);
+  assert(G0.WEIGHT == G1.WEIGHT);
+  cout << "Subtest 5 (weighted build(gen)) Passed" << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  test3();
+  test4();
+  test5();
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,141 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/graph/representations/StaticGraph.h"
+#include "../../../../Content/C++/graph/search/BreadthFirstSearch.h"
+#include "../../../../Content/C++/graph/search/ParallelBreadthFirstSearch.h"
+using namespace std;
+
+StaticGraph rmat(int lgV, int E, mt19937_64 &rng) {
+  int V = 1 << lgV;
+  StaticGraph G(V);
+  G.reserveDiEdges(E * 2);
+  uniform_real_distribution<double> dis(0.0, 1.0);
+  for (int i = 0; i < E; i++) {
+    int v = 0, w = 0;
+    for (int j = 0; j < lgV; j++) {
+      double p = dis(rng);
+      int a = p >= 0.57 && p < 0.76 ? 1 : 0, b = p >= 0.76 ? 1 : 0;
+      if (p >= 0.95) a = 1;
+      v = v * 2 + a;
+      w = w * 2 + b;
+    }
+    G.addBiEdge(v, w);
+  }
+  G.build();
+  return G;
+}
+
+StaticGraph grid(int R, int C) {
+  StaticGraph G(R * C);
+  G.reserveDiEdges(R * C * 4);
+  for (int i = 0; i < R; i++) for (int j = 0; j < C; j++) {
+    if (i + 1 < R) G.addBiEdge(i * C + j, (i + 1) * C + j);
+    if (j + 1 < C) G.addBiEdge(i * C + j, i * C + j + 1);
+  }
+  G.build();
+  return G;
+}
+
+void check(const StaticGraph &G, const vector<int> &dist, const vector<int> &par, const vector<int> &expected) {
+  assert(dist == expected);
+  const int INF = numeric_limits<int>::max();
+  vector<bool> found(G.size(), false);
+  for (int v = 0; v < G.size(); v++) for (int w : G[v]) if (par[w] == v) found[w] = true;
+  for (int v = 0; v < G.size(); v++) {
+    assert((par[v] == -1) == (dist[v] == 0 || dist[v] == INF));
+    if (par[v] != -1) {
+      assert(found[v]);
+      assert(dist[par[v]] + 1 == dist[v]);
+    }
+  }
+}
+
+template <class F> void run(const string &name, int subtest, const StaticGraph &G, F f, const vector<int> &expected = vector<int>(), const vector<int> &par = vector<int>()) {
+  const auto start_time = chrono::system_clock::now();
+  vector<int> dist = f();
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  if (!expected.empty()) check(G, dist, par, expected);
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  V: " << G.size() << endl;
+  cout << "  E: " << G.TO.size() << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  long long checkSum = 0;
+  for (auto &&d : dist) checkSum = (31 * checkSum + d) % (long long)(1e9 + 7);
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test1() {
+  mt19937_64 rng(0);
+  StaticGraph G = rmat(20, 8e6, rng);
+  vector<int> srcs{0, 1, 2, 3};
+  vector<int> dist, par;
+  run("RMAT BFS", 1, G, [&] {
+    BFS<int> bfs(G, srcs);
+    par = bfs.par;
+    return dist = bfs.dist;
+  });
+  check(G, dist, par, dist);
+  for (int T = 1; T <= 4; T *= 2) {
+    ThreadPool pool(T);
+    run("RMAT Parallel BFS, " + to_string(T) + " thread(s)", 1, G, [&] {
+      ParallelBFS<int> bfs(G, srcs, pool);
+      par = bfs.par;
+      return bfs.dist;
+    }, dist, par);
+  }
+}
+
+void test2() {
+  StaticGraph G = grid(2000, 2000);
+  vector<int> dist, par;
+  run("Grid BFS", 2, G, [&] {
+    BFS<int> bfs(G, 0);
+    par = bfs.par;
+    return dist = bfs.dist;
+  });
+  check(G, dist, par, dist);
+  for (int T = 1; T <= 4; T *= 2) {
+    ThreadPool pool(T);
+    run("Grid Parallel BFS, " + to_string(T) + " thread(s)", 2, G, [&] {
+      ParallelBFS<int> bfs(G, 0, pool);
+      par = bfs.par;
+      return bfs.dist;
+    }, dist, par);
+  }
+}
+
+void test3() {
+  mt19937_64 rng(0);
+  int V = 1e6, E = 4e6;
+  StaticGraph G(V), GR(V);
+  G.reserveDiEdges(E);
+  GR.reserveDiEdges(E);
+  for (int i = 0; i < E; i++) {
+    int v = rng() % V, w = rng() % V;
+    G.addDiEdge(v, w);
+    GR.addDiEdge(w, v);
+  }
+  G.build();
+  GR.build();
+  vector<int> dist, par;
+  run("Directed BFS", 3, G, [&] {
+    BFS<int> bfs(G, 0);
+    par = bfs.par;
+    return dist = bfs.dist;
+  });
+  check(G, dist, par, dist);
+  ThreadPool pool(4);
+  run("Directed Parallel BFS, 4 thread(s)", 3, G, [&] {
+    ParallelBFS<int> bfs(G, GR, vector<int>(1, 0), pool);
+    par = bfs.par;
+    return bfs.dist;
+  }, dist, par);
+}
+
+int main() {
+  test1();
+  test2();
+  test3();
+  cout << "Test Passed" << endl;
+  return 0;
+}
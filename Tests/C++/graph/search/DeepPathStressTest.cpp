@@ -0,0 +1,424 @@
+#include <bits/stdc++.h>
+#include <pthread.h>
+#include "../../../../Content/C++/graph/components/Biconnected.h"
+#include "../../../../Content/C++/graph/components/StronglyConnectedComponents.h"
+#include "../../../../Content/C++/graph/lowestcommonancestor/LowestCommonAncestor.h"
+#include "../../../../Content/C++/graph/queries/CentroidDecomposition.h"
+#include "../../../../Content/C++/graph/queries/HLD.h"
+#include "../../../../Content/C++/graph/representations/StaticGraph.h"
+#include "../../../../Content/C++/graph/search/DepthFirstOrder.h"
+using namespace std;
+
+// runs f in a std::thread with a stack of stackSize bytes (8MB by default),
+// regardless of ulimit -s
+template <class F> void runInThread(F f, size_t stackSize = 8 << 20) {
+  pthread_attr_t attr;
+  pthread_attr_init(&attr);
+  pthread_attr_setstacksize(&attr, stackSize);
+  pthread_setattr_default_np(&attr);
+  thread t(f);
+  t.join();
+  pthread_attr_destroy(&attr);
+}
+
+struct RecursiveSCC {
+  int V, ind, top; vector<int> id, low, stk; vector<vector<int>> components;
+  template <class Digraph> void dfs(const Digraph &G, int v) {
+    id[v] = -1; int mn = low[stk[top++] = v] = ind++; for (int w : G[v]) {
+      if (id[w] == -2) dfs(G, w);
+      mn = min(mn, low[w]);
+    }
+    if (mn < low[v]) { low[v] = mn; return; }
+    int w; components.emplace_back(); do {
+      id[w = stk[--top]] = components.size() - 1; low[w] = INT_MAX;
+      components.back().push_back(w);
+    } while (w != v);
+  }
+  template <class Digraph> RecursiveSCC(const Digraph &G)
+      : V(G.size()), ind(0), top(0), id(V, -2), low(V), stk(V) {
+    for (int v = 0; v < V; v++) if (id[v] == -2) dfs(G, v);
+  }
+};
+
+struct RecursiveEulerTour {
+  int ind; vector<int> root, pre, vert; vector<int> dist;
+  template <class Forest>
+  void dfs(const Forest &G, int v, int prev, int r, int d) {
+    root[v] = r; dist[v] = d; vert[pre[v] = ind++] = v; for (int w : G[v]) {
+      if (w != prev) { dfs(G, w, v, r, d + 1); vert[ind++] = v; }
+    }
+  }
+  template <class Forest> RecursiveEulerTour(const Forest &G, int rt)
+      : ind(0), root(G.size(), -1), pre(G.size()), vert(max(0, G.size() * 2 - 1)), dist(G.size()) {
+    dfs(G, rt, -1, rt, 0);
+  }
+};
+
+// the recursive versions below read the adjacency lists (and rev for
+// Biconnected) of the iterative structure, so both see the same edge order
+struct RecursiveBiconnected {
+  int cur; vector<int> low, pre, id; vector<bool> articulation;
+  vector<vector<int>> isBridge, components, forest; vector<pair<int, int>> s;
+  const vector<int> *adj, *rev;
+  void dfs(int v, int prev) {
+    int children = 0; pre[v] = low[v] = cur++;
+    for (int i = 0; i < int(adj[v].size()); i++) {
+      int w = adj[v][i];
+      if (pre[w] == -1) {
+        children++; s.emplace_back(v, w); dfs(w, v); low[v] = min(low[v], low[w]);
+        if ((prev == v && children > 1) || (prev != v && low[w] >= pre[v])) {
+          articulation[v] = true; components.emplace_back(); pair<int, int> e;
+          do {
+            e = s.back(); s.pop_back();
+            components.back().push_back(e.first); components.back().push_back(e.second);
+          } while (e != make_pair(v, w));
+        }
+        if (low[w] == pre[w]) isBridge[v][i] = isBridge[w][rev[v][i]] = true;
+      } else if (w != prev && pre[w] < low[v]) { low[v] = pre[w]; s.emplace_back(v, w); }
+    }
+  }
+  void dfs2(int v, int curId) {
+    id[v] = curId;
+    for (int i = 0; i < int(adj[v].size()); i++) if (id[adj[v][i]] == -1 && !isBridge[v][i]) dfs2(adj[v][i], curId);
+  }
+  RecursiveBiconnected(const vector<int> *adj, const vector<int> *rev, int V)
+      : cur(0), low(V, -1), pre(V, -1), id(V, -1), articulation(V, false), isBridge(V), adj(adj), rev(rev) {
+    for (int v = 0; v < V; v++) isBridge[v].assign(adj[v].size(), false);
+    for (int v = 0; v < V; v++) {
+      if (pre[v] == -1) dfs(v, v);
+      if (!s.empty()) {
+        components.emplace_back();
+        for (int j = int(s.size()) - 1; j >= 0; j--) { components.back().push_back(s[j].first); components.back().push_back(s[j].second); }
+        s.clear();
+      }
+    }
+    for (auto &&comp : components) { sort(comp.begin(), comp.end()); comp.erase(unique(comp.begin(), comp.end()), comp.end()); }
+    int forestN = 0;
+    for (int v = 0; v < V; v++) if (id[v] == -1) dfs2(v, forestN++);
+    forest.assign(forestN, vector<int>());
+    for (int v = 0; v < V; v++) for (int w : adj[v]) if (id[v] != id[w]) forest[id[v]].push_back(id[w]);
+  }
+};
+
+struct RecursiveDFSOrder {
+  int curPre, curPost, curRevPost; vector<int> preInd, preOrd, postOrd, revPostOrd;
+  const vector<int> *adj;
+  void dfs(int v) {
+    preOrd[preInd[v] = curPre++] = v;
+    for (int w : adj[v]) if (preInd[w] == -1) dfs(w);
+    postOrd[curPost++] = revPostOrd[curRevPost--] = v;
+  }
+  RecursiveDFSOrder(const vector<int> *adj, int V, int s)
+      : curPre(0), curPost(0), curRevPost(V - 1), preInd(V, -1), preOrd(V), postOrd(V), revPostOrd(V), adj(adj) {
+    dfs(s);
+    for (int v = 0; v < V; v++) if (preInd[v] == -1) dfs(v);
+  }
+};
+
+struct RecursiveHLD {
+  int curInd; vector<int> dep, par, size, head, pre, post, vert; const vector<int> *adj;
+  void dfs(int v, int prev, int d) {
+    dep[v] = d; par[v] = prev; size[v] = 1; head[v] = -1;
+    for (int w : adj[v]) if (w != prev) { dfs(w, v, d + 1); size[v] += size[w]; }
+  }
+  void hld(int v, int prev) {
+    if (head[v] == -1) head[v] = v;
+    vert[pre[v] = ++curInd] = v; int maxInd = -1;
+    for (int w : adj[v]) if (w != prev && (maxInd == -1 || size[maxInd] < size[w])) maxInd = w;
+    if (maxInd != -1) { head[maxInd] = head[v]; hld(maxInd, v); }
+    for (int w : adj[v]) if (w != prev && w != maxInd) hld(w, v);
+    post[v] = curInd;
+  }
+  RecursiveHLD(const vector<int> *adj, int V, int root)
+      : curInd(-1), dep(V), par(V), size(V), head(V), pre(V), post(V), vert(V), adj(adj) {
+    dfs(root, -1, 0); hld(root, -1);
+  }
+};
+
+struct RecursiveCentroidDecomposition {
+  vector<bool> exclude; vector<int> size, par; const vector<int> *adj;
+  int getSize(int v, int prev) {
+    size[v] = 1;
+    for (int w : adj[v]) if (w != prev && !exclude[w]) size[v] += getSize(w, v);
+    return size[v];
+  }
+  int getCentroid(int v, int prev, int treeSize) {
+    for (int w : adj[v]) if (w != prev && !exclude[w] && size[w] > treeSize / 2) return getCentroid(w, v, treeSize);
+    return v;
+  }
+  RecursiveCentroidDecomposition(const vector<int> *adj, int V, int root)
+      : exclude(V, false), size(V), par(V, -1), adj(adj) {
+    queue<pair<int, int>> q; q.emplace(root, -1);
+    while (!q.empty()) {
+      int v = q.front().first, c = getCentroid(v, -1, getSize(v, -1));
+      par[c] = q.front().second; q.pop(); exclude[c] = true;
+      for (int w : adj[c]) if (!exclude[w]) q.emplace(w, c);
+    }
+  }
+};
+
+StaticGraph pathGraph(int V, bool directed) {
+  StaticGraph G(V);
+  G.reserveDiEdges(V * 2);
+  for (int v = 0; v + 1 < V; v++) {
+    if (directed) G.addDiEdge(v, v + 1);
+    else G.addBiEdge(v, v + 1);
+  }
+  if (directed) G.addDiEdge(V - 1, 0);
+  G.build();
+  return G;
+}
+
+void test1() {
+  int V = 1e7;
+  StaticGraph DG = pathGraph(V, true), UG = pathGraph(V, false);
+  double sccSec = 0, lcaSec = 0;
+  long long checkSum = 0;
+  runInThread([&] {
+    auto start_time = chrono::system_clock::now();
+    SCC scc(DG);
+    auto end_time = chrono::system_clock::now();
+    sccSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    assert(int(scc.components.size()) == 1);
+    start_time = chrono::system_clock::now();
+    LCA<> lca(UG, 0);
+    end_time = chrono::system_clock::now();
+    lcaSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    mt19937_64 rng(0);
+    for (int i = 0; i < 1000; i++) {
+      int v = rng() % V, w = rng() % V;
+      assert(lca.lca(v, w) == min(v, w));
+      checkSum = (31 * checkSum + lca.getDist(v, w)) % (long long)(1e9 + 7);
+    }
+  });
+  cout << "Subtest 1 (10M path, 8MB stack) Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  SCC Time: " << fixed << setprecision(3) << sccSec << "s" << endl;
+  cout << "  LCA Time: " << fixed << setprecision(3) << lcaSec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  mt19937_64 rng(0);
+  int V = 1e6, E = 4e6;
+  StaticGraph PG = pathGraph(V, true), UG = pathGraph(V, false), RG(V);
+  RG.reserveDiEdges(E);
+  for (int i = 0; i < E; i++) RG.addDiEdge(rng() % V, rng() % V);
+  RG.build();
+  vector<pair<string, const StaticGraph *>> graphs = {{"path", &PG}, {"random", &RG}};
+  cout << "Subtest 2 (recursive vs iterative) Passed" << endl;
+  long long checkSum = 0;
+  for (auto &&g : graphs) {
+    auto start_time = chrono::system_clock::now();
+    RecursiveSCC scc0(*g.second);
+    auto end_time = chrono::system_clock::now();
+    double recSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    start_time = chrono::system_clock::now();
+    SCC scc1(*g.second);
+    end_time = chrono::system_clock::now();
+    double itSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    assert(scc0.id == scc1.id);
+    assert(scc0.components == scc1.components);
+    cout << "  SCC Time (recursive, " << g.first << "): " << fixed << setprecision(3) << recSec << "s" << endl;
+    cout << "  SCC Time (iterative, " << g.first << "): " << fixed << setprecision(3) << itSec << "s" << endl;
+    for (auto &&id : scc1.id) checkSum = (31 * checkSum + id) % (long long)(1e9 + 7);
+  }
+  auto start_time = chrono::system_clock::now();
+  RecursiveEulerTour tour(UG, 0);
+  auto end_time = chrono::system_clock::now();
+  double recSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  start_time = chrono::system_clock::now();
+  LCA<> lca(UG, 0);
+  end_time = chrono::system_clock::now();
+  double itSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  assert(tour.pre == lca.pre);
+  assert(tour.vert == lca.vert);
+  cout << "  Euler Tour Time (recursive, path): " << fixed << setprecision(3) << recSec << "s" << endl;
+  cout << "  LCA Time (iterative, path): " << fixed << setprecision(3) << itSec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+const int MAXV = 1e6 + 5;
+
+void test3() {
+  int V = 1e6;
+  unique_ptr<Biconnected<MAXV>> bcc(new Biconnected<MAXV>());
+  unique_ptr<DFSOrder<MAXV>> dfsOrder(new DFSOrder<MAXV>());
+  unique_ptr<HLD<MAXV, false, false>> hld(new HLD<MAXV, false, false>());
+  unique_ptr<CentroidDecomposition<MAXV>> cd(new CentroidDecomposition<MAXV>());
+  cd->init(V);
+  for (int v = 0; v + 1 < V; v++) {
+    bcc->addEdge(v, v + 1);
+    dfsOrder->addBiEdge(v, v + 1);
+    hld->addEdge(v, v + 1);
+    cd->addEdge(v, v + 1);
+  }
+  double sec = 0;
+  runInThread([&] {
+    const auto start_time = chrono::system_clock::now();
+    bcc->run(V);
+    bcc->genBridgeForest(V);
+    dfsOrder->run(V);
+    hld->run(V);
+    cd->bfs();
+    const auto end_time = chrono::system_clock::now();
+    sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  });
+  assert(int(bcc->components.size()) == V - 1);
+  for (int v = 0; v < V; v++) {
+    assert(bcc->articulation[v] == (v > 0 && v < V - 1));
+    assert(bcc->id[v] == v);
+    assert(dfsOrder->preOrd[v] == v);
+    assert(dfsOrder->postOrd[v] == V - 1 - v);
+    assert(hld->pre[v] == v && hld->head[v] == 0 && hld->size[v] == V - v);
+  }
+  int maxDepth = 0, root = -1;
+  long long checkSum = 0;
+  for (int v = 0; v < V; v++) {
+    int d = 0;
+    for (int w = v; cd->par[w] != -1; w = cd->par[w]) d++;
+    maxDepth = max(maxDepth, d);
+    if (cd->par[v] == -1) root = v;
+    checkSum = (31 * checkSum + cd->par[v]) % (long long)(1e9 + 7);
+  }
+  assert(maxDepth <= __lg(V) + 1);
+  assert(abs(root - V / 2) <= 1);
+  cout << "Subtest 3 (1M path, 8MB stack) Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+vector<pair<int, int>> randomTree(int V, bool deep, mt19937_64 &rng) {
+  vector<int> P(V);
+  iota(P.begin(), P.end(), 0);
+  shuffle(P.begin(), P.end(), rng);
+  vector<pair<int, int>> edges;
+  for (int v = 1; v < V; v++) {
+    int p = deep ? v - 1 - int(rng() % min(v, 3)) : int(rng() % v);
+    if (rng() % 2) edges.emplace_back(P[v], P[p]);
+    else edges.emplace_back(P[p], P[v]);
+  }
+  shuffle(edges.begin(), edges.end(), rng);
+  return edges;
+}
+
+vector<pair<int, int>> randomMultigraph(int V, int K, mt19937_64 &rng) {
+  vector<int> comp(V);
+  vector<vector<int>> verts(K);
+  for (int v = 0; v < V; v++) verts[comp[v] = rng() % K].push_back(v);
+  int E = rng() % (V * 3) + 1;
+  vector<pair<int, int>> edges;
+  for (int i = 0; i < E; i++) {
+    int v = rng() % V, w = verts[comp[v]][rng() % verts[comp[v]].size()];
+    edges.emplace_back(v, w);
+    if (rng() % 8 == 0) edges.emplace_back(w, v);
+  }
+  return edges;
+}
+
+void test4() {
+  const int TESTCASES = 60;
+  mt19937_64 rng(0);
+  unique_ptr<Biconnected<MAXV>> bcc(new Biconnected<MAXV>());
+  unique_ptr<DFSOrder<MAXV>> dfsOrder(new DFSOrder<MAXV>());
+  unique_ptr<HLD<MAXV, false, false>> hld(new HLD<MAXV, false, false>());
+  unique_ptr<CentroidDecomposition<MAXV>> cd(new CentroidDecomposition<MAXV>());
+  double itSec[4] = {0, 0, 0, 0}, recSec[4] = {0, 0, 0, 0};
+  long long checkSum = 0;
+  runInThread([&] {
+    for (int ti = 0; ti < TESTCASES; ti++) {
+      int V = ti < TESTCASES - 12 ? rng() % 100 + 1 : rng() % int(2e5) + 1;
+      bool tree = ti % 3 != 2;
+      vector<pair<int, int>> edges = tree ? randomTree(V, ti % 3 == 1, rng) : randomMultigraph(V, rng() % 4 + 1, rng);
+      int root = rng() % V;
+      bcc->clear(V);
+      dfsOrder->clear(V);
+      for (auto &&e : edges) {
+        bcc->addEdge(e.first, e.second);
+        dfsOrder->addEdge(e.first, e.second);
+      }
+      auto start_time = chrono::system_clock::now();
+      bcc->run(V);
+      bcc->genBridgeForest(V);
+      auto end_time = chrono::system_clock::now();
+      itSec[0] += ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+      start_time = chrono::system_clock::now();
+      RecursiveBiconnected bcc0(bcc->adj, bcc->rev, V);
+      end_time = chrono::system_clock::now();
+      recSec[0] += ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+      assert(bcc0.components == bcc->components);
+      assert(bcc0.forest == bcc->forest);
+      for (int v = 0; v < V; v++) {
+        assert(bcc0.articulation[v] == bcc->articulation[v]);
+        assert(bcc0.isBridge[v] == bcc->isBridge[v]);
+        assert(bcc0.id[v] == bcc->id[v]);
+      }
+      start_time = chrono::system_clock::now();
+      dfsOrder->run(V, root);
+      end_time = chrono::system_clock::now();
+      itSec[1] += ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+      start_time = chrono::system_clock::now();
+      RecursiveDFSOrder dfsOrder0(dfsOrder->adj, V, root);
+      end_time = chrono::system_clock::now();
+      recSec[1] += ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+      for (int v = 0; v < V; v++) {
+        assert(dfsOrder0.preInd[v] == dfsOrder->preInd[v]);
+        assert(dfsOrder0.preOrd[v] == dfsOrder->preOrd[v]);
+        assert(dfsOrder0.postOrd[v] == dfsOrder->postOrd[v]);
+        assert(dfsOrder0.revPostOrd[v] == dfsOrder->revPostOrd[v]);
+      }
+      for (auto &&comp : bcc->components) checkSum = (31 * checkSum + comp.size()) % (long long)(1e9 + 7);
+      if (!tree) continue;
+      hld->clear(V);
+      cd->init(V);
+      for (auto &&e : edges) {
+        hld->addEdge(e.first, e.second);
+        cd->addEdge(e.first, e.second);
+      }
+      start_time = chrono::system_clock::now();
+      hld->run(V, root);
+      end_time = chrono::system_clock::now();
+      itSec[2] += ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+      start_time = chrono::system_clock::now();
+      RecursiveHLD hld0(hld->adj, V, root);
+      end_time = chrono::system_clock::now();
+      recSec[2] += ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+      for (int v = 0; v < V; v++) {
+        assert(hld0.dep[v] == hld->dep[v]);
+        assert(hld0.par[v] == hld->par[v]);
+        assert(hld0.size[v] == hld->size[v]);
+        assert(hld0.head[v] == hld->head[v]);
+        assert(hld0.pre[v] == hld->pre[v]);
+        assert(hld0.post[v] == hld->post[v]);
+        assert(hld0.vert[v] == hld->vert[v]);
+      }
+      start_time = chrono::system_clock::now();
+      cd->bfs(root);
+      end_time = chrono::system_clock::now();
+      itSec[3] += ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+      start_time = chrono::system_clock::now();
+      RecursiveCentroidDecomposition cd0(cd->adj, V, root);
+      end_time = chrono::system_clock::now();
+      recSec[3] += ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+      for (int v = 0; v < V; v++) assert(cd0.par[v] == cd->par[v]);
+      for (int v = 0; v < V; v++) checkSum = (31 * checkSum + hld->pre[v] + cd->par[v]) % (long long)(1e9 + 7);
+    }
+  }, 256 << 20);
+  cout << "Subtest 4 (random trees and multigraphs, recursive vs iterative) Passed" << endl;
+  string names[4] = {"Biconnected", "DFSOrder", "HLD", "CentroidDecomposition"};
+  for (int i = 0; i < 4; i++) {
+    cout << "  " << names[i] << " Time (recursive): " << fixed << setprecision(3) << recSec[i] << "s" << endl;
+    cout << "  " << names[i] << " Time (iterative): " << fixed << setprecision(3) << itSec[i] << "s" << endl;
+  }
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  test3();
+  test4();
+  cout << "Test Passed" << endl;
+  return 0;
+}
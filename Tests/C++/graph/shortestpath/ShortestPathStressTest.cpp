@@ -0,0 +1,154 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/graph/representations/StaticGraph.h"
+#include "../../../../Content/C++/graph/shortestpath/DeltaSteppingSSSP.h"
+#include "../../../../Content/C++/graph/shortestpath/DijkstraSSSP.h"
+using namespace std;
+
+StaticWeightedGraph<long long> randomGraph(int V, int E, long long maxW, mt19937_64 &rng) {
+  StaticWeightedGraph<long long> G(V);
+  G.reserveDiEdges(E);
+  for (int i = 0; i < E; i++) {
+    int v = rng() % V, w = rng() % V;
+    G.addDiEdge(v, w, rng() % (maxW + 1));
+  }
+  G.build();
+  return G;
+}
+
+StaticWeightedGraph<long long> roadGraph(int R, int C, long long maxW, mt19937_64 &rng) {
+  StaticWeightedGraph<long long> G(R * C);
+  G.reserveDiEdges(R * C * 4);
+  for (int i = 0; i < R; i++) for (int j = 0; j < C; j++) {
+    if (i + 1 < R) G.addBiEdge(i * C + j, (i + 1) * C + j, rng() % maxW + 1);
+    if (j + 1 < C) G.addBiEdge(i * C + j, i * C + j + 1, rng() % maxW + 1);
+  }
+  G.build();
+  return G;
+}
+
+template <class SSSP> void check(const StaticWeightedGraph<long long> &G, SSSP &sssp, const vector<long long> &dist) {
+  assert(sssp.dist == dist);
+  for (int v = 0; v < G.size(); v++) if (sssp.par[v] != -1) {
+    bool found = false;
+    for (auto &&e : G[sssp.par[v]]) if (e.first == v && sssp.dist[sssp.par[v]] + e.second == sssp.dist[v]) found = true;
+    assert(found);
+  }
+  for (int v = 0; v < G.size(); v += G.size() / 100) if (sssp.dist[v] != sssp.INF) {
+    long long len = 0;
+    for (auto &&e : sssp.getPath(v)) len += get<2>(e);
+    assert(len == sssp.dist[v]);
+  }
+}
+
+template <class F> void run(const string &name, int subtest, const StaticWeightedGraph<long long> &G, F f) {
+  const auto start_time = chrono::system_clock::now();
+  vector<long long> dist = f();
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  V: " << G.size() << endl;
+  cout << "  E: " << G.TO.size() << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  long long checkSum = 0;
+  for (auto &&d : dist) checkSum = (31 * checkSum + d) % (long long)(1e9 + 7);
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void runAll(int subtest, const StaticWeightedGraph<long long> &G, const vector<int> &srcs) {
+  vector<long long> dist;
+  run("Dijkstra", subtest, G, [&] { return dist = DijkstraSSSP<long long>(G, srcs).dist; });
+  for (int T = 1; T <= 4; T *= 2) {
+    ThreadPool pool(T);
+    run("Delta Stepping, " + to_string(T) + " thread(s)", subtest, G, [&] {
+      DeltaSteppingSSSP<long long> sssp(G, srcs, pool);
+      check(G, sssp, dist);
+      return sssp.dist;
+    });
+  }
+}
+
+void test1() {
+  mt19937_64 rng(0);
+  runAll(1, randomGraph(1e6, 4e6, 1e9, rng), vector<int>{0});
+}
+
+void test2() {
+  mt19937_64 rng(0);
+  runAll(2, roadGraph(1000, 1000, 1000, rng), vector<int>{0, 500500});
+}
+
+void test3() {
+  mt19937_64 rng(0);
+  runAll(3, randomGraph(1e6, 4e6, 3, rng), vector<int>{0, 1, 2});
+}
+
+void test4() {
+  mt19937_64 rng(0);
+  StaticWeightedGraph<long long> G = roadGraph(300, 300, 1000, rng);
+  vector<long long> dist = DijkstraSSSP<long long>(G, 0).dist;
+  ThreadPool pool(4);
+  for (long long delta : {1LL, 10LL, 1000LL, 1000000LL}) {
+    run("Delta Stepping, delta = " + to_string(delta), 4, G, [&] {
+      DeltaSteppingSSSP<long long> sssp(G, 0, pool, delta);
+      check(G, sssp, dist);
+      return sssp.dist;
+    });
+  }
+  StaticWeightedGraph<long long> H = randomGraph(1e5, 4e5, 1e9, rng);
+  dist = DijkstraSSSP<long long>(H, 0).dist;
+  run("Delta Stepping, delta = 1, max weight = 1e9", 4, H, [&] {
+    DeltaSteppingSSSP<long long> sssp(H, 0, pool, 1);
+    check(H, sssp, dist);
+    return sssp.dist;
+  });
+}
+
+template <class PQ> void runPQ(const string &name, int subtest, const StaticWeightedGraph<long long> &G, const vector<long long> &dist) {
+  run(name, subtest, G, [&] {
+    DijkstraSSSP<long long, PQ> sssp(G, 0);
+    check(G, sssp, dist);
+    return sssp.dist;
+  });
+}
+
+void runAllPQ(int subtest, const StaticWeightedGraph<long long> &G) {
+  vector<long long> dist;
+  run("Dijkstra Binary Heap", subtest, G, [&] { return dist = DijkstraSSSP<long long>(G, 0).dist; });
+  runPQ<DijkstraRadixHeapPQ<long long>>("Dijkstra Radix Heap", subtest, G, dist);
+  runPQ<DijkstraIndexedHeapPQ<long long, 2>>("Dijkstra Indexed Binary Heap", subtest, G, dist);
+  runPQ<DijkstraIndexedHeapPQ<long long, 4>>("Dijkstra Indexed 4-ary Heap", subtest, G, dist);
+  runPQ<DijkstraIndexedHeapPQ<long long, 8>>("Dijkstra Indexed 8-ary Heap", subtest, G, dist);
+}
+
+void test5() {
+  mt19937_64 rng(0);
+  runAllPQ(5, randomGraph(2e6, 4e6, 1e9, rng));
+}
+
+void test6() {
+  mt19937_64 rng(0);
+  runAllPQ(6, roadGraph(1000, 1000, 1000, rng));
+}
+
+void test7() {
+  mt19937_64 rng(0);
+  runAllPQ(7, randomGraph(1e5, 4e6, 1e9, rng));
+}
+
+void test8() {
+  mt19937_64 rng(0);
+  runAllPQ(8, randomGraph(2e3, 4e6, 1e9, rng));
+}
+
+int main() {
+  test1();
+  test2();
+  test3();
+  test4();
+  test5();
+  test6();
+  test7();
+  test8();
+  cout << "Test Passed" << endl;
+  return 0;
+}
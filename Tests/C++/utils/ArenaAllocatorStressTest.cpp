@@ -0,0 +1,197 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/utils/ArenaAllocator.h"
+#include "../../../Content/C++/datastructures/trees/binarysearchtrees/BSTNode.h"
+#include "../../../Content/C++/datastructures/trees/binarysearchtrees/Splay.h"
+#include "../../../Content/C++/datastructures/trees/binarysearchtrees/Treap.h"
+#include "../../../Content/C++/datastructures/trees/heaps/LeftistHeap.h"
+using namespace std;
+
+const int ROUNDS = 5, TREE_N = 2e5, HEAP_N = 2e5, HEAPS = 16;
+using Node = NodeVal<int>;
+
+template <class Tree> long long treeRound(Tree &T, mt19937_64 &rng) {
+  Node *root = T.build(TREE_N, [&] { return int(rng() % int(1e9)); });
+  for (int i = 0; i < TREE_N / 4; i++) {
+    int l = rng() % TREE_N, r = rng() % TREE_N;
+    if (l > r) swap(l, r);
+    T.applyToRange(root, l, r, [&] (Node *x) { x->reverse(); });
+  }
+  long long checkSum = 0;
+  for (int i = 0; i < TREE_N; i += 100)
+    checkSum = (31 * checkSum + T.select(root, i)->val) % (long long)(1e9 + 7);
+  return checkSum;
+}
+
+template <class Heap, class MakeHeap>
+long long heapRound(MakeHeap makeHeap, mt19937_64 &rng) {
+  vector<Heap> H;
+  for (int h = 0; h < HEAPS; h++) H.push_back(makeHeap());
+  for (int i = 0; i < HEAP_N; i++) H[i % HEAPS].push(rng() % int(1e9));
+  for (int h = 1; h < HEAPS; h++) H[0].merge(H[h]);
+  long long checkSum = 0;
+  while (!H[0].empty())
+    checkSum = (31 * checkSum + H[0].pop()) % (long long)(1e9 + 7);
+  return checkSum;
+}
+
+template <class F> long long rounds(F f, double &sec) {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  long long checkSum = 0;
+  for (int r = 0; r < ROUNDS; r++)
+    checkSum = (31 * checkSum + f(rng)) % (long long)(1e9 + 7);
+  const auto end_time = chrono::system_clock::now();
+  sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  return checkSum;
+}
+
+void print(int subtest, const string &name, double sec0, double sec1,
+           long long checkSum) {
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  std::allocator Time: " << fixed << setprecision(3) << sec0
+       << "s" << endl;
+  cout << "  ArenaAllocator Time: " << fixed << setprecision(3) << sec1
+       << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test1() {
+  double sec0, sec1;
+  long long checkSum0 = rounds([&] (mt19937_64 &rng) {
+    Treap<Node> T; return treeRound(T, rng);
+  }, sec0);
+  long long checkSum1 = rounds([&] (mt19937_64 &rng) {
+    ArenaScope scope; Treap<Node, ArenaAllocator<Node>> T;
+    return treeRound(T, rng);
+  }, sec1);
+  assert(checkSum0 == checkSum1);
+  print(1, "Treap", sec0, sec1, checkSum0);
+}
+
+void test2() {
+  double sec0, sec1;
+  long long checkSum0 = rounds([&] (mt19937_64 &rng) {
+    Splay<Node> T; return treeRound(T, rng);
+  }, sec0);
+  long long checkSum1 = rounds([&] (mt19937_64 &rng) {
+    ArenaScope scope; Splay<Node, deque<Node, ArenaAllocator<Node>>> T;
+    return treeRound(T, rng);
+  }, sec1);
+  assert(checkSum0 == checkSum1);
+  print(2, "Splay", sec0, sec1, checkSum0);
+}
+
+void test3() {
+  using Heap0 = LeftistHeap<int>;
+  using Heap1 = LeftistHeap<int, less<int>, ArenaAllocator<int>>;
+  double sec0, sec1;
+  long long checkSum0 = rounds([&] (mt19937_64 &rng) {
+    return heapRound<Heap0>([&] { return Heap0(); }, rng);
+  }, sec0);
+  long long checkSum1 = rounds([&] (mt19937_64 &rng) {
+    ArenaScope scope; return heapRound<Heap1>([&] { return Heap1(); }, rng);
+  }, sec1);
+  assert(checkSum0 == checkSum1);
+  print(3, "LeftistHeap", sec0, sec1, checkSum0);
+}
+
+void test4() {
+  using Heap = LeftistHeap<int, less<int>, ArenaAllocator<int>>;
+  const auto start_time = chrono::system_clock::now();
+  int T = 3; vector<long long> checkSums(T);
+  vector<thread> threads;
+  for (int t = 0; t < T; t++) threads.emplace_back([&, t] {
+    double sec; checkSums[t] = rounds([&] (mt19937_64 &rng) {
+      ArenaScope scope; return heapRound<Heap>([&] { return Heap(); }, rng);
+    }, sec);
+    threadArena().release();
+  });
+  for (auto &&t : threads) t.join();
+  for (int t = 1; t < T; t++) assert(checkSums[t] == checkSums[0]);
+  cout << "Subtest 4 (LeftistHeap, thread local arenas) Passed" << endl;
+  cout << "  Threads: " << T << endl;
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSums[0] << endl;
+}
+
+void test5() {
+  struct ListNode { long long v; arena_ptr<ListNode> next; };
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  Arena &A = threadArena(); A.reset();
+  ArenaAllocator<ListNode> alloc;
+  long long checkSum = 0;
+  for (int ti = 0; ti < 20; ti++) {
+    size_t m = A.mark(); int N = rng() % int(1e6) + 1;
+    vector<long long> expected(N);
+    arena_ptr<ListNode> head;
+    for (int i = 0; i < N; i++) {
+      if (rng() % 16 == 0) A.allocate(rng() % 100 + 1, 1);
+      ListNode *x = alloc.allocate(1);
+      assert(uintptr_t(x) % alignof(ListNode) == 0);
+      expected[N - 1 - i] = x->v = rng() % int(1e9); x->next = head;
+      head = arena_ptr<ListNode>(x);
+    }
+    assert(sizeof(head) == 4);
+    int i = 0;
+    for (arena_ptr<ListNode> x = head; x; x = x->next, i++) {
+      assert(x->v == expected[i]);
+      checkSum = (31 * checkSum + x->v) % (long long)(1e9 + 7);
+    }
+    assert(i == N);
+    A.rewind(m); assert(A.mark() == m);
+  }
+  A.release();
+  cout << "Subtest 5 (arena_ptr, mark and rewind) Passed" << endl;
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+Arena &sharedArena() { static Arena A; return A; }
+
+void test6() {
+  struct ListNode { long long v; arena_ptr<ListNode, sharedArena> next; };
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  ArenaAllocator<ListNode> alloc(sharedArena());
+  int N = 1e6;
+  arena_ptr<ListNode, sharedArena> head;
+  long long expected = 0;
+  for (int i = 0; i < N; i++) {
+    ListNode *x = alloc.allocate(1);
+    x->v = rng() % int(1e9); x->next = head;
+    head = arena_ptr<ListNode, sharedArena>(x);
+  }
+  for (auto x = head; x; x = x->next)
+    expected = (31 * expected + x->v) % (long long)(1e9 + 7);
+  int T = 3; vector<long long> checkSums(T, 0);
+  vector<thread> threads;
+  for (int t = 0; t < T; t++) threads.emplace_back([&, t] {
+    for (auto x = head; x; x = x->next)
+      checkSums[t] = (31 * checkSums[t] + x->v) % (long long)(1e9 + 7);
+  });
+  for (auto &&t : threads) t.join();
+  for (int t = 0; t < T; t++) assert(checkSums[t] == expected);
+  sharedArena().release();
+  cout << "Subtest 6 (arena_ptr, shared arena) Passed" << endl;
+  cout << "  Threads: " << T << endl;
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << expected << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  test3();
+  test4();
+  test5();
+  test6();
+  cout << "Test Passed" << endl;
+  return 0;
+}
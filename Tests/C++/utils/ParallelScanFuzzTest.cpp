@@ -0,0 +1,83 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/utils/ParallelScan.h"
+using namespace std;
+
+const long long MOD = 1e9 + 7;
+
+struct Max {
+  long long operator () (long long a, long long b) { return max(a, b); }
+};
+
+struct Affine {
+  pair<long long, long long> operator () (const pair<long long, long long> &f,
+                                          const pair<long long, long long> &g) {
+    return make_pair(f.first * g.first % MOD,
+                     (f.second * g.first + g.second) % MOD);
+  }
+};
+
+long long key(long long a) { return a; }
+long long key(const pair<long long, long long> &a) {
+  return a.first * 31 + a.second;
+}
+
+template <class T, class Op, class Gen>
+void test(int subtest, const string &name, Gen gen, T init, Op op,
+          ThreadPool *pool) {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 300;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = ti % 3 == 0 ? rng() % 101 : rng() % 300001;
+    vector<T> A(N);
+    for (auto &&a : A) a = gen(rng);
+    vector<T> inc0(N), exc0(N);
+    T total0 = init;
+    for (int i = 0; i < N; i++) {
+      exc0[i] = total0; total0 = op(total0, A[i]); inc0[i] = total0;
+    }
+    vector<T> inc1(N), exc1(N), inc2 = A;
+    T total1 = pool ? inclusiveScan(A.begin(), A.end(), inc1.begin(), init,
+                                    op, *pool)
+                    : inclusiveScan(A.begin(), A.end(), inc1.begin(), init,
+                                    op);
+    T total2 = pool ? exclusiveScan(A.data(), A.data() + N, exc1.data(),
+                                    init, op, *pool)
+                    : exclusiveScan(A.data(), A.data() + N, exc1.data(),
+                                    init, op);
+    T total3 = pool ? inclusiveScan(inc2.begin(), inc2.end(), inc2.begin(),
+                                    init, op, *pool)
+                    : inclusiveScan(inc2.begin(), inc2.end(), inc2.begin(),
+                                    init, op);
+    assert(inc0 == inc1);
+    assert(exc0 == exc1);
+    assert(inc0 == inc2);
+    assert(total0 == total1 && total0 == total2 && total0 == total3);
+    assert(total0 == reduceRange(A.begin(), A.end(), init, op));
+    for (auto &&a : inc0) checkSum = ((31 * checkSum + key(a)) % MOD + MOD) % MOD;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  ThreadPool pool(4);
+  auto genInt = [&] (mt19937_64 &rng) {
+    return (long long)(rng() % int(1e9)) - int(5e8);
+  };
+  auto genAffine = [&] (mt19937_64 &rng) {
+    return make_pair((long long)(rng() % MOD), (long long)(rng() % MOD));
+  };
+  test(1, "plus", genInt, 0LL, plus<long long>(), nullptr);
+  test(2, "plus, pool", genInt, 0LL, plus<long long>(), &pool);
+  test(3, "max", genInt, LLONG_MIN, Max(), nullptr);
+  test(4, "max, pool", genInt, LLONG_MIN, Max(), &pool);
+  test(5, "affine", genAffine, make_pair(1LL, 0LL), Affine(), nullptr);
+  test(6, "affine, pool", genAffine, make_pair(1LL, 0LL), Affine(), &pool);
+  cout << "Test Passed" << endl;
+  return 0;
+}
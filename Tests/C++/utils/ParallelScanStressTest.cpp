@@ -0,0 +1,66 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/utils/ParallelScan.h"
+using namespace std;
+
+void test(int subtest, long long N) {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  vector<long long> A(N);
+  for (auto &&a : A) a = rng() % int(1e9);
+  auto t = chrono::system_clock::now();
+  long long sum0 = accumulate(A.begin(), A.end(), 0LL);
+  auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - t).count() / double(chrono::system_clock::period::den));
+  cout << "  std::accumulate: " << fixed << setprecision(3) << sec
+       << "s" << endl;
+  t = chrono::system_clock::now();
+  long long sum1 = reduceRange(A.begin(), A.end(), 0LL);
+  end_time = chrono::system_clock::now();
+  sec = ((end_time - t).count() / double(chrono::system_clock::period::den));
+  cout << "  reduceRange: " << fixed << setprecision(3) << sec << "s" << endl;
+  assert(sum0 == sum1);
+  vector<long long> B(N);
+  t = chrono::system_clock::now();
+  partial_sum(A.begin(), A.end(), B.begin());
+  end_time = chrono::system_clock::now();
+  sec = ((end_time - t).count() / double(chrono::system_clock::period::den));
+  cout << "  std::partial_sum: " << fixed << setprecision(3) << sec
+       << "s" << endl;
+  t = chrono::system_clock::now();
+  long long sum2 = inclusiveScan(A.begin(), A.end(), A.begin(), 0LL);
+  end_time = chrono::system_clock::now();
+  sec = ((end_time - t).count() / double(chrono::system_clock::period::den));
+  cout << "  inclusiveScan: " << fixed << setprecision(3) << sec
+       << "s" << endl;
+  assert(sum0 == sum2 && A == B);
+  for (long long i = N - 1; i > 0; i--) A[i] -= A[i - 1];
+  for (ThreadPool *pool : {new ThreadPool(), new ThreadPool(4)}) {
+    t = chrono::system_clock::now();
+    long long sum3 = exclusiveScan(A.begin(), A.end(), A.begin(), 0LL,
+                                   plus<long long>(), *pool);
+    end_time = chrono::system_clock::now();
+    sec = ((end_time - t).count() / double(chrono::system_clock::period::den));
+    cout << "  exclusiveScan (" << pool->size() << " threads): " << fixed
+         << setprecision(3) << sec << "s" << endl;
+    assert(sum3 == sum0);
+    for (long long i = 0; i < N; i++) {
+      assert(A[i] == (i == 0 ? 0 : B[i - 1])); A[i] = B[i] - A[i];
+    }
+    delete pool;
+  }
+  long long checkSum = 0;
+  for (long long i = 0; i < N; i += N / 1000 + 1)
+    checkSum = (31 * checkSum + B[i]) % (long long)(1e9 + 7);
+  cout << "Subtest " << subtest << " (N = " << N << ") Passed" << endl;
+  end_time = chrono::system_clock::now();
+  sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test(1, 1e6);
+  test(2, 1.5e8);
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,84 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/utils/StaticAllocator.h"
+#include "../../../Content/C++/datastructures/trees/binarysearchtrees/BSTNode.h"
+#include "../../../Content/C++/datastructures/trees/binarysearchtrees/Splay.h"
+#include "../../../Content/C++/datastructures/trees/binarysearchtrees/Treap.h"
+#include "../../../Content/C++/datastructures/trees/heaps/LeftistHeap.h"
+using namespace std;
+
+const int ROUNDS = 5, TREE_N = 2e5, HEAP_N = 2e5, HEAPS = 16;
+using Node = NodeVal<int>;
+
+template <class Tree> long long treeRound(Tree &T, mt19937_64 &rng) {
+  Node *root = T.build(TREE_N, [&] { return int(rng() % int(1e9)); });
+  for (int i = 0; i < TREE_N / 4; i++) {
+    int l = rng() % TREE_N, r = rng() % TREE_N;
+    if (l > r) swap(l, r);
+    T.applyToRange(root, l, r, [&] (Node *x) { x->reverse(); });
+  }
+  long long checkSum = 0;
+  for (int i = 0; i < TREE_N; i += 100)
+    checkSum = (31 * checkSum + T.select(root, i)->val) % (long long)(1e9 + 7);
+  return checkSum;
+}
+
+template <class Heap, class MakeHeap>
+long long heapRound(MakeHeap makeHeap, mt19937_64 &rng) {
+  vector<Heap> H;
+  for (int h = 0; h < HEAPS; h++) H.push_back(makeHeap());
+  for (int i = 0; i < HEAP_N; i++) H[i % HEAPS].push(rng() % int(1e9));
+  for (int h = 1; h < HEAPS; h++) H[0].merge(H[h]);
+  long long checkSum = 0;
+  while (!H[0].empty())
+    checkSum = (31 * checkSum + H[0].pop()) % (long long)(1e9 + 7);
+  return checkSum;
+}
+
+template <class F> long long rounds(F f, double &sec) {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  long long checkSum = 0;
+  for (int r = 0; r < ROUNDS; r++)
+    checkSum = (31 * checkSum + f(rng)) % (long long)(1e9 + 7);
+  const auto end_time = chrono::system_clock::now();
+  sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  return checkSum;
+}
+
+void print(int subtest, const string &name, double sec, long long checkSum) {
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  StaticAllocator Time: " << fixed << setprecision(3) << sec
+       << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test1() {
+  double sec; long long checkSum = rounds([&] (mt19937_64 &rng) {
+    Treap<Node, StaticAllocator<Node>> T; return treeRound(T, rng);
+  }, sec);
+  print(1, "Treap", sec, checkSum);
+}
+
+void test2() {
+  double sec; long long checkSum = rounds([&] (mt19937_64 &rng) {
+    Splay<Node, deque<Node, StaticAllocator<Node>>> T;
+    return treeRound(T, rng);
+  }, sec);
+  print(2, "Splay", sec, checkSum);
+}
+
+void test3() {
+  using Heap = LeftistHeap<int, less<int>, StaticAllocator<int>>;
+  double sec; long long checkSum = rounds([&] (mt19937_64 &rng) {
+    return heapRound<Heap>([&] { return Heap(); }, rng);
+  }, sec);
+  print(3, "LeftistHeap", sec, checkSum);
+}
+
+int main() {
+  test1();
+  test2();
+  test3();
+  cout << "Test Passed" << endl;
+  return 0;
+}